@@ -0,0 +1,1110 @@
+// dear imgui: "null" benchmark application
+// (compile and link imgui, create context, run synthetic scenes headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// Each scene is run for a fixed number of frames in a fresh context, and we report per-phase timings,
+// vertex/index counts, draw calls and heap allocations as JSON. This is used to track performance regressions
+// on machines without a GPU (e.g. CI runners). Build with WITH_PROFILER=1 to also report built-in profiler zones.
+//
+// Usage: example_null_benchmark [--frames N] [--warmup N] [--scene NAME] [--json FILE] [--list]
+//   --frames N     Number of measured frames per scene (default: 300)
+//   --warmup N     Number of frames to run before measuring (default: 30)
+//   --scene NAME   Only run scenes whose name contains NAME (may be repeated)
+//   --json FILE    Write JSON report to FILE instead of stdout
+//   --list         List available scenes and exit
+
+#include "imgui.h"
+#include "imgui_internal.h"     // For TextViewer(), ImGuiInputTextState and profiler zones
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+// For imgui_impl_null: use relative filename + embed implementation directly by including the .cpp file.
+// This is to simplify casual building of this example from all sorts of test scripts.
+#include "../../backends/imgui_impl_null.h"
+#include "../../backends/imgui_impl_null.cpp"
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Count heap allocations made by Dear ImGui (see ImGui::SetAllocatorFunctions())
+struct BenchAllocCounters
+{
+    int     AllocCount;
+    size_t  AllocBytes;
+};
+static BenchAllocCounters g_AllocCounters = {};
+
+static void* BenchMalloc(size_t size, void* user_data)
+{
+    BenchAllocCounters* counters = (BenchAllocCounters*)user_data;
+    counters->AllocCount++;
+    counters->AllocBytes += size;
+    return malloc(size);
+}
+
+static void BenchFree(void* ptr, void* user_data)
+{
+    IM_UNUSED(user_data);
+    free(ptr);
+}
+
+// Accumulate samples for one measured value
+struct BenchSamples
+{
+    ImVector<double> Values;
+
+    void    Add(double v) { Values.push_back(v); }
+    double  Sum() const { double sum = 0.0; for (double v : Values) sum += v; return sum; }
+    double  Avg() const { return Values.Size > 0 ? Sum() / Values.Size : 0.0; }
+    double  Percentile(float p) const
+    {
+        if (Values.Size == 0)
+            return 0.0;
+        ImVector<double> sorted = Values;
+        qsort(sorted.Data, (size_t)sorted.Size, sizeof(double), [](const void* a, const void* b) { double d = *(const double*)a - *(const double*)b; return (d > 0.0) - (d < 0.0); });
+        int idx = (int)(p * (sorted.Size - 1) + 0.5f);
+        return sorted[idx];
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Scenes
+//-----------------------------------------------------------------------------
+// Each scene function is called once per frame between NewFrame() and Render().
+// Scenes should be deterministic: don't use time or random values without a fixed seed.
+//-----------------------------------------------------------------------------
+
+static void BeginFullscreenWindow(const char* name, ImGuiWindowFlags flags = 0)
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->WorkPos);
+    ImGui::SetNextWindowSize(viewport->WorkSize);
+    ImGui::Begin(name, NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings | flags);
+}
+
+// 10k buttons in a scrolling window. Most of them are clipped, so this mostly measures item submission overhead.
+static void Scene_Buttons(int frame)
+{
+    IM_UNUSED(frame);
+    BeginFullscreenWindow("Buttons");
+    for (int n = 0; n < 10000; n++)
+    {
+        ImGui::PushID(n);
+        if ((n % 10) != 0)
+            ImGui::SameLine();
+        ImGui::Button("Button");
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Large table with clipper, frozen header row, 20 columns x 100k rows, scrolling every frame.
+static void Scene_TableLarge(int frame)
+{
+    BeginFullscreenWindow("Table");
+    const int columns_count = 20;
+    const int rows_count = 100000;
+    ImGuiTableFlags flags = ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+    if (ImGui::BeginTable("table", columns_count, flags))
+    {
+        ImGui::TableSetupScrollFreeze(1, 1);
+        for (int column = 0; column < columns_count; column++)
+        {
+            char label[32];
+            snprintf(label, sizeof(label), "Column %d", column);
+            ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_WidthFixed, 100.0f);
+        }
+        ImGui::TableHeadersRow();
+        ImGui::SetScrollY((float)(frame % 1000) * ImGui::GetTextLineHeightWithSpacing());
+        ImGuiListClipper clipper;
+        clipper.Begin(rows_count);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::TableNextRow();
+                for (int column = 0; column < columns_count; column++)
+                {
+                    ImGui::TableSetColumnIndex(column);
+                    if (column == 0)
+                        ImGui::Text("Row %d", row);
+                    else
+                        ImGui::Text("%.3f", row * 0.1f + column);
+                }
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Very wide virtualized table, 2000 columns x 1M rows, submitted with TableVirtualCells() and scrolling on both axes every frame.
+static void Scene_TableVirtual_Cell(void* user_data, int row, int column)
+{
+    IM_UNUSED(user_data);
+    if (column == 0)
+        ImGui::Text("Row %d", row);
+    else
+        ImGui::Text("%.3f", row * 0.1f + column);
+}
+
+static void Scene_TableVirtual(int frame)
+{
+    BeginFullscreenWindow("TableVirtual");
+    const int columns_count = 2000;
+    const int rows_count = 1000000;
+    ImGuiTableFlags flags = ImGuiTableFlags_Virtualized | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+    if (ImGui::BeginTable("table", columns_count, flags))
+    {
+        ImGui::TableSetupScrollFreeze(1, 1);
+        for (int column = 0; column < columns_count; column++)
+        {
+            char label[32];
+            snprintf(label, sizeof(label), "Column %d", column);
+            ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_WidthFixed, 80.0f);
+        }
+        ImGui::TableHeadersRow();
+        ImGui::SetScrollX((float)(frame * 397 % 150000));
+        ImGui::SetScrollY((float)(frame * 7919 % 15000000));
+        ImGui::TableVirtualCells(rows_count, Scene_TableVirtual_Cell, NULL);
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Sorted table of 1M rows where 100 rows change every frame, kept in order with ImGuiTableSortStorage incremental updates.
+static int Scene_TableSort_Compare(void* user_data, const ImGuiTableColumnSortSpecs* spec, int item_a, int item_b)
+{
+    const float* values = (const float*)user_data + spec->ColumnIndex;
+    const float a = values[item_a * 2];
+    const float b = values[item_b * 2];
+    return (a > b) - (a < b);
+}
+
+static void Scene_TableSort(int frame)
+{
+    const int rows_count = 1000000;
+    static ImVector<float> values; // 2 values per row
+    static ImGuiTableSortStorage sort_storage;
+    if (frame == 0)
+    {
+        values.resize(rows_count * 2);
+        for (int n = 0; n < values.Size; n++)
+            values[n] = (float)(((unsigned int)n * 7919u) % 100003u);
+        sort_storage.Clear();
+        sort_storage.UserData = values.Data;
+        sort_storage.CompareFunc = Scene_TableSort_Compare;
+    }
+    for (int n = 0; n < 100; n++)
+    {
+        const int row = (frame * 7907 + n * 104729) % rows_count;
+        values[row * 2] += 1.0f;
+        sort_storage.MarkItemDirty(row);
+    }
+
+    BeginFullscreenWindow("TableSort");
+    if (ImGui::BeginTable("table", 3, ImGuiTableFlags_ScrollY | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Value A", ImGuiTableColumnFlags_DefaultSort);
+        ImGui::TableSetupColumn("Value B");
+        ImGui::TableSetupColumn("Index", ImGuiTableColumnFlags_NoSort);
+        ImGui::TableHeadersRow();
+        sort_storage.ApplySortSpecs(ImGui::TableGetSortSpecs(), rows_count);
+        ImGuiListClipper clipper;
+        clipper.Begin(rows_count);
+        while (clipper.Step())
+            for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+            {
+                const int item_n = sort_storage.Items[row_n];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", values[item_n * 2 + 0]);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", values[item_n * 2 + 1]);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", item_n);
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Table of 1M rows fed by an ImGuiTableDataSource, where a simulated worker formats 16 requested rows per frame into a small cache.
+// Scrolls to a new position every 8 frames, so most frames display a mix of placeholders and formatted rows.
+struct Scene_TableStream_Cache
+{
+    int     Rows[256];                  // Row stored in each slot, or -1
+    char    Cells[256][4][16];
+    int     QueueNext, QueueEnd;        // Requested rows not formatted yet
+};
+
+static void Scene_TableStream_RequestRows(void* user_data, int row_start, int row_end)
+{
+    Scene_TableStream_Cache* cache = (Scene_TableStream_Cache*)user_data;
+    IM_ASSERT(row_end - row_start <= IM_COUNTOF(cache->Rows));
+    cache->QueueNext = row_start;
+    cache->QueueEnd = row_end;
+}
+
+static const char* Scene_TableStream_GetCellText(void* user_data, int row_n, int column_n, const char** out_text_end)
+{
+    IM_UNUSED(out_text_end);
+    Scene_TableStream_Cache* cache = (Scene_TableStream_Cache*)user_data;
+    const int slot = row_n % IM_COUNTOF(cache->Rows);
+    return (cache->Rows[slot] == row_n) ? cache->Cells[slot][column_n] : NULL;
+}
+
+static void Scene_TableStream(int frame)
+{
+    const int rows_count = 1000000;
+    static Scene_TableStream_Cache cache;
+    static ImGuiTableDataSource source;
+    if (frame == 0)
+    {
+        memset(cache.Rows, -1, sizeof(cache.Rows));
+        cache.QueueNext = cache.QueueEnd = 0;
+        source = ImGuiTableDataSource();
+        source.UserData = &cache;
+        source.RowsCount = rows_count;
+        source.RequestRowsFunc = Scene_TableStream_RequestRows;
+        source.GetCellTextFunc = Scene_TableStream_GetCellText;
+    }
+
+    // Simulated worker thread
+    for (int n = 0; n < 16 && cache.QueueNext < cache.QueueEnd; n++, cache.QueueNext++)
+    {
+        const int row_n = cache.QueueNext;
+        const int slot = row_n % IM_COUNTOF(cache.Rows);
+        cache.Rows[slot] = row_n;
+        snprintf(cache.Cells[slot][0], 16, "Row %d", row_n);
+        for (int column_n = 1; column_n < 4; column_n++)
+            snprintf(cache.Cells[slot][column_n], 16, "%.3f", row_n * 0.1f + column_n);
+    }
+
+    BeginFullscreenWindow("TableStream");
+    if (ImGui::BeginTable("table", 4, ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("A");
+        ImGui::TableSetupColumn("B");
+        ImGui::TableSetupColumn("C");
+        ImGui::TableHeadersRow();
+        ImGui::SetScrollY((float)((frame / 8) * 7919 % 15000000));
+        ImGui::TableVirtualCells(&source);
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Numeric grid of 50 columns x 1000 rows, every cell formatted with Text("%d") or Text("%.3f") (rows are not clipped).
+// Build with WITH_NO_FAST_NUMBER_FORMAT=1 or WITH_STB_SPRINTF=1 to compare with vsnprintf() or stb_sprintf.h.
+static void Scene_TableNumeric(int frame)
+{
+    BeginFullscreenWindow("TableNumeric");
+    if (ImGui::BeginTable("table", 50, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedSame))
+    {
+        for (int row = 0; row < 1000; row++)
+        {
+            ImGui::TableNextRow();
+            for (int column = 0; column < 50; column++)
+            {
+                ImGui::TableSetColumnIndex(column);
+                if (column & 1)
+                    ImGui::Text("%.3f", (row * 50 + column + frame) * 0.37f);
+                else
+                    ImGui::Text("%d", row * 50 + column - frame);
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Typical dashboard/debug overlay formats through Text(), LabelText() and BulletText(): 2000 panels of 8 lines.
+static void Scene_TextFormats(int frame)
+{
+    static const char* names[] = { "Render", "Physics", "Audio", "Network", "Scripts", "Streaming" };
+    BeginFullscreenWindow("TextFormats");
+    for (int n = 0; n < 2000; n++)
+    {
+        const float t = (n + frame) * 0.37f;
+        const char* name = names[n % IM_COUNTOF(names)];
+        ImGui::Text("%s: %d", name, n * 13 + frame);
+        ImGui::Text("FPS: %.1f (%.3f ms/frame)", 60.0f + t * 0.01f, 1000.0f / (60.0f + t * 0.01f));
+        ImGui::LabelText("Position", "%.2f, %.2f, %.2f", t, -t * 0.5f, t * 2.0f);
+        ImGui::BulletText("%s (%d items)", name, n);
+        ImGui::Text("Memory: %5.1f%% of %d MB", (n % 1000) * 0.1f, 4096);
+        ImGui::Text("ID 0x%08X", (unsigned int)(n * 2654435761u));
+        ImGui::Text("%d/%d", n, 2000);
+        ImGui::Text("%s", name);
+    }
+    ImGui::End();
+}
+
+// Capture a 10 columns x 5000 rows table to a log callback every frame (e.g. exporting a table dump).
+static void Scene_LogCaptureTable_Callback(void* user_data, const char* text, int text_len)
+{
+    IM_UNUSED(text);
+    *(size_t*)user_data += (size_t)text_len;
+}
+
+static void Scene_LogCaptureTable(int frame)
+{
+    static size_t captured_bytes = 0;
+    BeginFullscreenWindow("LogCaptureTable");
+    ImGui::LogToCallback(Scene_LogCaptureTable_Callback, &captured_bytes);
+    if (ImGui::BeginTable("table", 10))
+    {
+        for (int row = 0; row < 5000; row++)
+        {
+            ImGui::TableNextRow();
+            for (int column = 0; column < 10; column++)
+            {
+                ImGui::TableSetColumnIndex(column);
+                ImGui::Text("%d", row * 10 + column + frame);
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::LogFinish();
+    ImGui::End();
+}
+
+// Mostly static table of 20 columns x 100k rows submitted with TableNextRowCached(): scrolling by one row every 8 frames, and one row in 16 changing every frame.
+static void Scene_TableCachedRows(int frame)
+{
+    BeginFullscreenWindow("TableCachedRows");
+    const int columns_count = 20;
+    if (ImGui::BeginTable("table", columns_count, ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedSame))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        for (int column = 0; column < columns_count; column++)
+            ImGui::TableSetupColumn(column == 0 ? "Row" : "Value");
+        ImGui::TableHeadersRow();
+        ImGui::SetScrollY((float)(frame / 8) * ImGui::GetTextLineHeightWithSpacing());
+        ImGuiListClipper clipper;
+        clipper.Begin(100000);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                const int version = ((row & 15) == 0) ? frame : 0;
+                if (!ImGui::TableNextRowCached((ImGuiID)row, (ImU64)version))
+                    continue;
+                for (int column = 0; column < columns_count; column++)
+                {
+                    ImGui::TableSetColumnIndex(column);
+                    if (column == 0)
+                        ImGui::Text("Row %d", row);
+                    else
+                        ImGui::Text("%.3f", row * 0.1f + column + version);
+                }
+            }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Dashboard of 500 small tables in one window, with stable sizes and settings.
+static void Scene_TablesMany(int frame)
+{
+    IM_UNUSED(frame);
+    BeginFullscreenWindow("TablesMany");
+    for (int table_n = 0; table_n < 500; table_n++)
+    {
+        ImGui::PushID(table_n);
+        if (ImGui::BeginTable("table", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable))
+        {
+            ImGui::TableSetupColumn("Name");
+            ImGui::TableSetupColumn("Value");
+            ImGui::TableSetupColumn("Min");
+            ImGui::TableSetupColumn("Max");
+            ImGui::TableHeadersRow();
+            for (int row = 0; row < 4; row++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("Item %d", row);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", table_n * 4 + row);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("0");
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("100");
+            }
+            ImGui::EndTable();
+        }
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Long text: one large unformatted block + wrapped paragraphs.
+static void Scene_TextLong(int frame)
+{
+    IM_UNUSED(frame);
+    static ImGuiTextBuffer text;
+    if (text.empty())
+        for (int n = 0; n < 20000; n++)
+            text.appendf("%05d The quick brown fox jumps over the lazy dog. 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ\n", n);
+    BeginFullscreenWindow("Text");
+    ImGui::BeginChild("unformatted", ImVec2(0.0f, ImGui::GetContentRegionAvail().y * 0.5f), ImGuiChildFlags_Borders);
+    ImGui::TextUnformatted(text.begin(), text.end());
+    ImGui::EndChild();
+    ImGui::BeginChild("wrapped", ImVec2(0.0f, 0.0f), ImGuiChildFlags_Borders);
+    for (int n = 0; n < 50; n++)
+        ImGui::TextWrapped("%d: Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat.", n);
+    ImGui::EndChild();
+    ImGui::End();
+}
+
+// Filter a list of 1M strings with ImGuiTextFilter::PassFilterBatch() every frame (changing filter), and display passing items with a clipper.
+// Measures text filter throughput: ~50 MB of text searched per frame.
+static void Scene_TextFilter(int frame)
+{
+    static ImGuiTextBuffer items_buf;
+    static ImVector<const char*> items;
+    static ImVector<int> items_passing;
+    if (items.empty())
+    {
+        ImVector<int> offsets;
+        for (int n = 0; n < 1000000; n++)
+        {
+            offsets.push_back(items_buf.size());
+            items_buf.appendf("item_%07d src/module_%03d/subsystem/File_%d.cpp", n, n % 997, n % 10007);
+            items_buf.Buf.push_back(0); // Keep zero-terminator of each item
+        }
+        for (int offset : offsets)
+            items.push_back(items_buf.begin() + offset);
+    }
+    static const char* filters[] = { "file_1234.", "-.cpp", "zzz", "MODULE_042/,item_00", "subsystem/file_9999" };
+    ImGuiTextFilter filter(filters[frame % IM_COUNTOF(filters)]);
+    items_passing.resize(0);
+    filter.PassFilterBatch(items.Data, items.Size, &items_passing);
+
+    BeginFullscreenWindow("TextFilter");
+    ImGui::Text("%d / %d items", items_passing.Size, items.Size);
+    ImGuiListClipper clipper;
+    clipper.Begin(items_passing.Size);
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            ImGui::TextUnformatted(items[items_passing[n]]);
+    ImGui::End();
+}
+
+// Plots: many PlotLines()/PlotHistogram() of 1000 values.
+static void Scene_Plots(int frame)
+{
+    static float values[1000];
+    for (int n = 0; n < IM_COUNTOF(values); n++)
+        values[n] = sinf((n + frame) * 0.05f) * cosf(n * 0.013f);
+    BeginFullscreenWindow("Plots");
+    for (int n = 0; n < 20; n++)
+    {
+        ImGui::PushID(n);
+        if (n & 1)
+            ImGui::PlotHistogram("##histogram", values, IM_COUNTOF(values), 0, NULL, -1.0f, 1.0f, ImVec2(0.0f, 40.0f));
+        else
+            ImGui::PlotLines("##lines", values, IM_COUNTOF(values), 0, NULL, -1.0f, 1.0f, ImVec2(0.0f, 40.0f));
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Deep tree: 30 levels x 64 leaves per level, all nodes open.
+// (tree depth is tracked in 32-bit masks by TreeNode(), see TreeHasStackDataDepthMask: don't go deeper than 31 levels)
+static void Scene_TreeDeep(int frame)
+{
+    IM_UNUSED(frame);
+    BeginFullscreenWindow("Tree");
+    int depth = 0;
+    for (; depth < 30; depth++)
+    {
+        for (int leaf = 0; leaf < 64; leaf++)
+            ImGui::TreeNodeEx((void*)(intptr_t)leaf, ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen, "Leaf %d.%d", depth, leaf);
+        ImGui::SetNextItemOpen(true);
+        if (!ImGui::TreeNode("Node", "Node %d", depth))
+            break;
+    }
+    for (; depth > 0; depth--)
+        ImGui::TreePop();
+    ImGui::End();
+}
+
+// Tree of ~3M nodes (100 x 100 x 300) displayed with ImGuiTreeView and ImGuiListClipper, all nodes open, scrolling every frame.
+// Every 16 frames the first second-level node is closed or opened again, which removes/inserts its 300 children in the flattened index.
+static int Scene_TreeView_GetChildrenCount(void* user_data, int node)
+{
+    IM_UNUSED(user_data);
+    return (node == -1) ? 100 : (node < 100) ? 100 : (node < 10100) ? 300 : 0;
+}
+
+static int Scene_TreeView_GetChild(void* user_data, int node, int child_n)
+{
+    IM_UNUSED(user_data);
+    return (node == -1) ? child_n : (node < 100) ? 100 + node * 100 + child_n : 10100 + (node - 100) * 300 + child_n;
+}
+
+static void Scene_TreeView(int frame)
+{
+    static ImGuiTreeView tree;
+    if (tree.GetChildFunc == NULL)
+    {
+        tree.GetChildrenCountFunc = Scene_TreeView_GetChildrenCount;
+        tree.GetChildFunc = Scene_TreeView_GetChild;
+        for (int node = 0; node < 10100; node++)
+            tree.OpenStorage.SetInt((ImGuiID)node, 1);
+        tree.Rebuild();
+    }
+    if ((frame % 16) == 15)
+        tree.SetNodeOpen(1, ((frame / 16) & 1) != 0);
+    tree.ApplyRequests();
+
+    BeginFullscreenWindow("TreeView");
+    ImGui::SetScrollY((float)((frame * 7919) % tree.Nodes.Size) * ImGui::GetTextLineHeightWithSpacing());
+    ImGuiListClipper clipper;
+    clipper.Begin(tree.Nodes.Size);
+    while (clipper.Step())
+        for (int node_n = clipper.DisplayStart; node_n < clipper.DisplayEnd; node_n++)
+        {
+            char label[32];
+            snprintf(label, sizeof(label), "Node %d", tree.Nodes[node_n].Node);
+            ImGui::TreeViewNode(&tree, node_n, label, ImGuiTreeNodeFlags_DrawLinesToNodes);
+        }
+    ImGui::End();
+}
+
+// Many windows: 500 small windows with a few widgets each.
+static void Scene_WindowsMany(int frame)
+{
+    IM_UNUSED(frame);
+    static float values[500] = {};
+    for (int n = 0; n < 500; n++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Window %03d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)(n % 25) * 75.0f, (float)(n / 25) * 50.0f), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(200.0f, 100.0f), ImGuiCond_Once);
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Hello from window %d", n);
+        ImGui::SliderFloat("value", &values[n], 0.0f, 1.0f);
+        ImGui::End();
+    }
+}
+
+// Thousands of windows: 1000 top-level windows with 4 child windows each, focusing a different one every frame.
+// Stresses hovered window lookup and display order maintenance.
+static void Scene_Windows5k(int frame)
+{
+    for (int n = 0; n < 1000; n++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Window %04d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)(n % 40) * 45.0f, (float)(n / 40) * 40.0f), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(120.0f, 90.0f), ImGuiCond_Once);
+        if (n == (frame * 7) % 1000)
+            ImGui::SetNextWindowFocus();
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+        for (int child_n = 0; child_n < 4; child_n++)
+        {
+            ImGui::PushID(child_n);
+            ImGui::BeginChild("child", ImVec2(24.0f, 24.0f), ImGuiChildFlags_Borders);
+            ImGui::EndChild();
+            ImGui::PopID();
+            ImGui::SameLine();
+        }
+        ImGui::End();
+    }
+}
+
+// Wrapped log view of 2M lines of varying heights, clipped with ImGuiListClipper::BeginWithHeights() and scrolling every frame.
+static void Scene_LogWrapped(int frame)
+{
+    static ImGuiListClipperHeights heights;
+    static const char* sentences[] =
+    {
+        "Lorem ipsum dolor sit amet.",
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat.",
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.",
+    };
+    BeginFullscreenWindow("LogWrapped");
+    ImGui::SetScrollY((float)(frame * 997 % 20000000));
+    ImGuiListClipper clipper;
+    clipper.BeginWithHeights(2000000, &heights);
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            ImGui::TextWrapped("%07d %s", n, sentences[n % IM_COUNTOF(sentences)]);
+    ImGui::End();
+}
+
+// Colored view of a ~100 MB append-only log with TextViewer(), growing by 100 lines and scrolling every frame.
+// The tokenizer colors timestamps, levels and quoted strings, and dims "BEGIN".."END" blocks which span multiple lines (using the line state).
+static int Scene_TextViewer_Tokenize(void* user_data, const char* line_begin, const char* line_end, int state, ImVector<ImGuiTextViewerSpan>* out_spans)
+{
+    IM_UNUSED(user_data);
+    const int line_len = (int)(line_end - line_begin);
+    const bool begin_block = (line_len >= 16 && memcmp(line_begin + 11, "BEGIN", 5) == 0);
+    const bool end_block = (line_len >= 14 && memcmp(line_begin + 11, "END", 3) == 0);
+    const int state_out = begin_block ? 1 : end_block ? 0 : state;
+    if (out_spans == NULL)
+        return state_out;
+    const ImU32 default_col = (state || begin_block) ? IM_COL32(128, 128, 128, 255) : 0;
+    ImGuiTextViewerSpan span = { 0, IM_COL32(100, 180, 255, 255) };
+    out_spans->push_back(span);
+    span.Offset = 10;
+    span.Col = default_col;
+    if (line_len >= 16 && memcmp(line_begin + 11, "ERROR", 5) == 0)
+        span.Col = IM_COL32(255, 80, 80, 255);
+    else if (line_len >= 15 && memcmp(line_begin + 11, "WARN", 4) == 0)
+        span.Col = IM_COL32(255, 200, 80, 255);
+    out_spans->push_back(span);
+    bool in_string = false;
+    for (const char* p = line_begin + 16; p < line_end; p++)
+        if (*p == '"')
+        {
+            in_string = !in_string;
+            span.Offset = (int)(p - line_begin) + (in_string ? 0 : 1);
+            span.Col = in_string ? IM_COL32(120, 220, 120, 255) : default_col;
+            out_spans->push_back(span);
+        }
+    return state_out;
+}
+
+static void Scene_TextViewer_AppendLines(ImGuiTextBuffer* buf, int line_n, int count)
+{
+    static const char* levels[] = { "INFO ", "INFO ", "INFO ", "WARN ", "ERROR", "BEGIN", "INFO ", "END  " };
+    for (int n = line_n; n < line_n + count; n++)
+        buf->appendf("[%08d] %s request id=%d path=\"/api/items/%d\" status=%d\n", n, levels[n % IM_COUNTOF(levels)], n * 7, n % 1000, 200 + (n % 5) * 100);
+}
+
+static void Scene_TextViewer(int frame)
+{
+    static ImGuiTextBuffer log;
+    static int log_lines = 0;
+    static ImGuiTextViewer viewer;
+    if (log_lines == 0)
+    {
+        log.Buf.reserve(110 * 1024 * 1024);
+        while (log.size() < 100 * 1024 * 1024)
+        {
+            Scene_TextViewer_AppendLines(&log, log_lines, 1000);
+            log_lines += 1000;
+        }
+        viewer.TokenizeFunc = Scene_TextViewer_Tokenize;
+    }
+    Scene_TextViewer_AppendLines(&log, log_lines, 100);
+    log_lines += 100;
+
+    BeginFullscreenWindow("TextViewer");
+    if (frame & 1)
+        ImGui::SetNextWindowScroll(ImVec2(-1.0f, (float)((frame * 7919) % log_lines) * ImGui::GetTextLineHeight()));
+    ImGui::TextViewer("##log", &viewer, log.begin(), log.end());
+    ImGui::End();
+}
+
+// ~64 MB ImGuiTextLog in ring mode, growing by 1000 lines every frame (so oldest chunks are dropped) and scrolling every other frame.
+static void Scene_TextLogRing(int frame)
+{
+    static ImGuiTextLog log;
+    static int log_lines = 0;
+    if (log_lines == 0)
+    {
+        log.MaxSize = 64 * 1024 * 1024;
+        while (log.GetLinesDropped() == 0)
+        {
+            for (int n = log_lines; n < log_lines + 1000; n++)
+                log.appendf("[%08d] request id=%d path=\"/api/items/%d\" status=%d\n", n, n * 7, n % 1000, 200 + (n % 5) * 100);
+            log_lines += 1000;
+        }
+    }
+    for (int n = log_lines; n < log_lines + 1000; n++)
+        log.appendf("[%08d] request id=%d path=\"/api/items/%d\" status=%d\n", n, n * 7, n % 1000, 200 + (n % 5) * 100);
+    log_lines += 1000;
+
+    BeginFullscreenWindow("TextLog");
+    if (frame & 1)
+        ImGui::SetNextWindowScroll(ImVec2(-1.0f, (float)((frame * 7919) % log.GetLinesCount()) * ImGui::GetTextLineHeight()));
+    ImGui::TextLogView("##log", &log);
+    ImGui::End();
+}
+
+// Keyboard navigation over a 2D canvas of 100k navigable items, moving down/up every other frame.
+// Every item is submitted (no clipping) so they are all visited by the navigation move request.
+static void Scene_NavCanvas_Input(ImGuiIO& io, int frame)
+{
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    const ImGuiKey key = ((frame / 100) & 1) ? ImGuiKey_UpArrow : ImGuiKey_DownArrow;
+    io.AddKeyEvent(key, (frame & 1) == 0);
+}
+
+static void Scene_NavCanvas(int frame)
+{
+    if (frame == 0)
+        ImGui::SetNextWindowFocus();
+    BeginFullscreenWindow("NavCanvas");
+    if (frame == 1)
+        ImGui::SetKeyboardFocusHere();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < 100000; n++)
+    {
+        ImGui::SetCursorScreenPos(ImVec2(p.x + (float)(n % 250) * 20.0f, p.y + (float)(n / 250) * 20.0f));
+        ImGui::PushID(n);
+        ImGui::InvisibleButton("##item", ImVec2(16.0f, 16.0f), ImGuiButtonFlags_EnableNav);
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Typing near the start of a 20 MB multi-line text (~500k lines), after activating it with a click.
+static void Scene_InputTextLarge_Input(ImGuiIO& io, int frame)
+{
+    if (frame == 1 || frame == 2)
+        io.AddMouseButtonEvent(0, frame == 1);
+    else if (frame > 2)
+        io.AddInputCharacter('x');
+}
+
+// Moving the cursor in an activated 20 MB multi-line text, without editing it.
+static void Scene_InputTextLarge_InputNavigate(ImGuiIO& io, int frame)
+{
+    if (frame == 1 || frame == 2)
+        io.AddMouseButtonEvent(0, frame == 1);
+    else if (frame > 2)
+        io.AddKeyEvent(ImGuiKey_DownArrow, (frame & 1) != 0);
+}
+
+static void Scene_InputTextLarge(int frame, ImGuiInputTextFlags flags)
+{
+    static ImVector<char> buf;
+    if (frame == 0)
+    {
+        buf.resize(20 * 1024 * 1024 + 64 * 1024);
+        int len = 0;
+        for (int line_n = 0; len < 20 * 1024 * 1024; line_n++)
+            len += snprintf(buf.Data + len, (size_t)(buf.Size - len), "key_%06d = %d ; some value text\n", line_n, line_n * 7);
+    }
+    BeginFullscreenWindow("InputTextLarge");
+    ImGui::InputTextMultiline("##text", buf.Data, (size_t)buf.Size, ImVec2(-FLT_MIN, -FLT_MIN), flags);
+    ImGui::End();
+}
+static void Scene_InputTextLargeLiveEdit(int frame) { Scene_InputTextLarge(frame, ImGuiInputTextFlags_None); }
+static void Scene_InputTextLargeNoLiveEdit(int frame) { Scene_InputTextLarge(frame, ImGuiInputTextFlags_NoLiveEdit); }
+static void Scene_InputTextLargeWordWrap(int frame) { Scene_InputTextLarge(frame, ImGuiInputTextFlags_NoLiveEdit | ImGuiInputTextFlags_WordWrap); }
+
+// Typing with 1000 carets (at the start of each of the first 1000 lines) in the 20 MB text: each keystroke is applied to all carets as a single edit.
+static void Scene_InputTextLargeMultiCaret(int frame)
+{
+    Scene_InputTextLarge(frame, ImGuiInputTextFlags_None);
+    ImGuiInputTextState* state = ImGui::GetInputTextState(ImGui::GetActiveID());
+    if (frame != 3 || state == NULL)
+        return;
+    const char* text = state->TextA.Data;
+    const char* p = text;
+    for (int line_n = 0; line_n < 1000; line_n++, p = strchr(p, '\n') + 1)
+        state->AddCaret((int)(p - text), (int)(p - text));
+}
+
+// Multi-selection over a clipped list of 1M items, cycling through Ctrl+A (select all), Click, Shift+Click on an item ~300k rows away
+// (range extend), while iterating the whole selection every frame. Run with both ImGuiSelectionBasicStorage and ImGuiSelectionRangeStorage.
+static void Scene_Selection_Input(ImGuiIO& io, int frame)
+{
+    const int phase = frame % 6;
+    if (phase == 0 || phase == 1)
+    {
+        io.AddKeyEvent(ImGuiMod_Ctrl, phase == 0);
+        io.AddKeyEvent(ImGuiKey_A, phase == 0);
+    }
+    if (phase == 4 || phase == 5)
+        io.AddKeyEvent(ImGuiMod_Shift, phase == 4);
+    if (phase >= 2)
+        io.AddMouseButtonEvent(0, (phase & 1) == 0);
+}
+
+static void Scene_Selection(int frame, bool use_ranges)
+{
+    static ImGuiSelectionBasicStorage basic_selection;
+    static ImGuiSelectionRangeStorage range_selection;
+    const int items_count = 1000000;
+
+    if (frame == 0)
+        ImGui::SetNextWindowFocus();
+    BeginFullscreenWindow(use_ranges ? "SelectionRange" : "SelectionBasic");
+    ImGui::SetScrollY((float)(((frame / 3) * 299993) % (items_count - 100)) * ImGui::GetTextLineHeightWithSpacing());
+
+    // Iterate whole selection
+    int selected_count = 0;
+    void* it = NULL;
+    ImGuiID id;
+    if (use_ranges)
+        while (range_selection.GetNextSelectedItem(&it, &id))
+            selected_count++;
+    else
+        while (basic_selection.GetNextSelectedItem(&it, &id))
+            selected_count++;
+    ImGui::Text("%d selected", selected_count);
+
+    ImGuiMultiSelectIO* ms_io = ImGui::BeginMultiSelect(ImGuiMultiSelectFlags_ClearOnEscape, use_ranges ? range_selection.Size : basic_selection.Size, items_count);
+    if (use_ranges)
+        range_selection.ApplyRequests(ms_io);
+    else
+        basic_selection.ApplyRequests(ms_io);
+    ImGuiListClipper clipper;
+    clipper.Begin(items_count);
+    if (ms_io->RangeSrcItem != -1)
+        clipper.IncludeItemByIndex((int)ms_io->RangeSrcItem);
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            char label[32];
+            snprintf(label, sizeof(label), "Item %07d", n);
+            const bool is_selected = use_ranges ? range_selection.Contains(n) : basic_selection.Contains((ImGuiID)n);
+            ImGui::SetNextItemSelectionUserData(n);
+            ImGui::Selectable(label, is_selected);
+        }
+    ms_io = ImGui::EndMultiSelect();
+    if (use_ranges)
+        range_selection.ApplyRequests(ms_io);
+    else
+        basic_selection.ApplyRequests(ms_io);
+    ImGui::End();
+}
+static void Scene_SelectionBasic(int frame) { Scene_Selection(frame, false); }
+static void Scene_SelectionRange(int frame) { Scene_Selection(frame, true); }
+
+// Heavy custom drawing: 20k primitives submitted to the window draw list.
+static void Scene_CustomDraw(int frame)
+{
+    BeginFullscreenWindow("CustomDraw");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < 5000; n++)
+    {
+        const float x = p.x + (float)((n * 37 + frame) % 1800);
+        const float y = p.y + (float)((n * 53) % 1000);
+        const ImU32 col = IM_COL32(n & 255, (n * 7) & 255, (n * 13) & 255, 255);
+        draw_list->AddLine(ImVec2(x, y), ImVec2(x + 20.0f, y + 10.0f), col, 1.5f);
+        draw_list->AddRectFilled(ImVec2(x, y), ImVec2(x + 8.0f, y + 8.0f), col, 2.0f);
+        draw_list->AddCircle(ImVec2(x, y), 6.0f, col);
+        draw_list->AddText(ImVec2(x, y + 12.0f), col, "text");
+    }
+    ImGui::End();
+}
+
+struct BenchScene
+{
+    const char* Name;
+    void        (*Func)(int frame);
+    void        (*Input)(ImGuiIO& io, int frame);   // Optional: queue input events before NewFrame()
+};
+
+static const BenchScene g_Scenes[] =
+{
+    { "buttons_10k",          Scene_Buttons,       NULL },
+    { "table_large",          Scene_TableLarge,    NULL },
+    { "table_virtual_2k_1m",  Scene_TableVirtual,  NULL },
+    { "table_sort_1m",        Scene_TableSort,     NULL },
+    { "table_stream_1m",      Scene_TableStream,   NULL },
+    { "table_numeric_50k",    Scene_TableNumeric,  NULL },
+    { "text_formats_16k",     Scene_TextFormats,   NULL },
+    { "log_capture_table_50k", Scene_LogCaptureTable, NULL },
+    { "table_cached_rows",    Scene_TableCachedRows, NULL },
+    { "tables_many_500",      Scene_TablesMany,    NULL },
+    { "text_long",            Scene_TextLong,      NULL },
+    { "log_wrapped_2m",       Scene_LogWrapped,    NULL },
+    { "text_viewer_100m",     Scene_TextViewer,    NULL },
+    { "text_log_ring_64m",    Scene_TextLogRing,   NULL },
+    { "text_filter_1m",       Scene_TextFilter,    NULL },
+    { "plots",                Scene_Plots,         NULL },
+    { "tree_deep",            Scene_TreeDeep,      NULL },
+    { "tree_view_3m",         Scene_TreeView,      NULL },
+    { "windows_many",         Scene_WindowsMany,   NULL },
+    { "windows_5k",           Scene_Windows5k,     NULL },
+    { "nav_canvas_100k",      Scene_NavCanvas,     Scene_NavCanvas_Input },
+    { "input_text_20m",       Scene_InputTextLargeLiveEdit, Scene_InputTextLarge_Input },
+    { "input_text_20m_no_live_edit", Scene_InputTextLargeNoLiveEdit, Scene_InputTextLarge_Input },
+    { "input_text_20m_word_wrap", Scene_InputTextLargeWordWrap, Scene_InputTextLarge_Input },
+    { "input_text_20m_navigate", Scene_InputTextLargeLiveEdit, Scene_InputTextLarge_InputNavigate },
+    { "input_text_20m_multicaret", Scene_InputTextLargeMultiCaret, Scene_InputTextLarge_Input },
+    { "selection_basic_1m",   Scene_SelectionBasic, Scene_Selection_Input },
+    { "selection_range_1m",   Scene_SelectionRange, Scene_Selection_Input },
+    { "custom_draw",          Scene_CustomDraw,    NULL },
+};
+
+//-----------------------------------------------------------------------------
+// Runner
+//-----------------------------------------------------------------------------
+
+struct BenchResult
+{
+    const char*     Name;
+    BenchSamples    TimeNewFrame;
+    BenchSamples    TimeSubmit;
+    BenchSamples    TimeRender;
+    BenchSamples    TimeTotal;
+    BenchSamples    Allocs;
+    BenchSamples    AllocBytes;
+    int             VtxCount;           // Last frame
+    int             IdxCount;
+    int             DrawCalls;
+    int             DrawLists;
+};
+
+static void RunScene(const BenchScene* scene, BenchResult* result, int warmup_frames, int frames, FILE* f_json_profiler)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    ImGui_ImplNullPlatform_Init();
+    ImGui_ImplNullRender_Init();
+
+    result->Name = scene->Name;
+    for (int n = 0; n < warmup_frames + frames; n++)
+    {
+        const bool measure = (n >= warmup_frames);
+        const BenchAllocCounters allocs_backup = g_AllocCounters;
+
+        ImGui_ImplNullPlatform_NewFrame();
+        ImGui_ImplNullRender_NewFrame();
+        io.AddMousePosEvent(io.DisplaySize.x * 0.5f, io.DisplaySize.y * 0.5f);
+        if (scene->Input)
+            scene->Input(io, n);
+
+        const double t0 = GetTimeMs();
+        ImGui::NewFrame();
+        const double t1 = GetTimeMs();
+        scene->Func(n);
+        const double t2 = GetTimeMs();
+        ImGui::Render();
+        ImGui_ImplNullRender_RenderDrawData(ImGui::GetDrawData());
+        const double t3 = GetTimeMs();
+        const BenchAllocCounters allocs_frame = { g_AllocCounters.AllocCount - allocs_backup.AllocCount, g_AllocCounters.AllocBytes - allocs_backup.AllocBytes };
+
+        if (!measure)
+            continue;
+        result->TimeNewFrame.Add(t1 - t0);
+        result->TimeSubmit.Add(t2 - t1);
+        result->TimeRender.Add(t3 - t2);
+        result->TimeTotal.Add(t3 - t0);
+        result->Allocs.Add((double)allocs_frame.AllocCount);
+        result->AllocBytes.Add((double)allocs_frame.AllocBytes);
+
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        result->VtxCount = draw_data->TotalVtxCount;
+        result->IdxCount = draw_data->TotalIdxCount;
+        result->DrawLists = draw_data->CmdListsCount;
+        result->DrawCalls = 0;
+        for (ImDrawList* draw_list : draw_data->CmdLists)
+            result->DrawCalls += draw_list->CmdBuffer.Size;
+    }
+
+#ifdef IMGUI_ENABLE_PROFILER
+    // Output average timings of built-in profiler zones
+    if (f_json_profiler)
+    {
+        ImGuiContext& g = *ImGui::GetCurrentContext();
+        fprintf(f_json_profiler, ",\n      \"profiler_zones_avg_ms\": {");
+        for (int n = 0; n < g.Profiler.Zones.Size; n++)
+            fprintf(f_json_profiler, "%s\n        \"%s\": %.4f", n > 0 ? "," : "", g.Profiler.Zones[n].Name, g.Profiler.Zones[n].TimeAvgMs);
+        fprintf(f_json_profiler, "\n      }");
+    }
+#else
+    IM_UNUSED(f_json_profiler);
+#endif
+
+    ImGui_ImplNullRender_Shutdown();
+    ImGui_ImplNullPlatform_Shutdown();
+    ImGui::DestroyContext();
+}
+
+static void WriteJsonSamples(FILE* f, const char* name, const BenchSamples& samples, bool last = false)
+{
+    fprintf(f, "        \"%s\": { \"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"max\": %.4f }%s\n", name, samples.Avg(), samples.Percentile(0.50f), samples.Percentile(0.95f), samples.Percentile(1.0f), last ? "" : ",");
+}
+
+static bool SceneMatchesFilters(const BenchScene* scene, const ImVector<const char*>& filters)
+{
+    if (filters.Size == 0)
+        return true;
+    for (const char* filter : filters)
+        if (strstr(scene->Name, filter) != NULL)
+            return true;
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+
+    int frames = 300;
+    int warmup_frames = 30;
+    const char* json_filename = NULL;
+    ImVector<const char*> scene_filters;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--frames") == 0 && n + 1 < argc)
+            frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--warmup") == 0 && n + 1 < argc)
+            warmup_frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--scene") == 0 && n + 1 < argc)
+            scene_filters.push_back(argv[++n]);
+        else if (strcmp(argv[n], "--json") == 0 && n + 1 < argc)
+            json_filename = argv[++n];
+        else if (strcmp(argv[n], "--list") == 0)
+        {
+            for (const BenchScene& scene : g_Scenes)
+                printf("%s\n", scene.Name);
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--scene NAME] [--json FILE] [--list]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (frames < 1)
+        frames = 1;
+
+    FILE* f = json_filename ? fopen(json_filename, "wt") : stdout;
+    if (f == NULL)
+    {
+        fprintf(stderr, "Error opening '%s'\n", json_filename);
+        return 1;
+    }
+
+    ImGui::SetAllocatorFunctions(BenchMalloc, BenchFree, &g_AllocCounters);
+
+    fprintf(f, "{\n  \"imgui_version\": \"%s\",\n  \"frames\": %d,\n  \"warmup_frames\": %d,\n  \"scenes\": [", IMGUI_VERSION, frames, warmup_frames);
+    int scenes_count = 0;
+    for (const BenchScene& scene : g_Scenes)
+    {
+        if (!SceneMatchesFilters(&scene, scene_filters))
+            continue;
+        fprintf(stderr, "Running '%s'...\n", scene.Name);
+        fprintf(f, "%s\n    {\n      \"name\": \"%s\"", scenes_count++ > 0 ? "," : "", scene.Name);
+
+        BenchResult result;
+        RunScene(&scene, &result, warmup_frames, frames, f);
+
+        fprintf(f, ",\n      \"time_ms\": {\n");
+        WriteJsonSamples(f, "new_frame", result.TimeNewFrame);
+        WriteJsonSamples(f, "submit", result.TimeSubmit);
+        WriteJsonSamples(f, "render", result.TimeRender);
+        WriteJsonSamples(f, "total", result.TimeTotal, true);
+        fprintf(f, "      },\n");
+        fprintf(f, "      \"vtx_count\": %d,\n      \"idx_count\": %d,\n      \"draw_calls\": %d,\n      \"draw_lists\": %d,\n", result.VtxCount, result.IdxCount, result.DrawCalls, result.DrawLists);
+        fprintf(f, "      \"allocs_per_frame\": %.2f,\n      \"alloc_bytes_per_frame\": %.1f\n    }", result.Allocs.Avg(), result.AllocBytes.Avg());
+        fprintf(stderr, "  total %.3f ms/frame (new_frame %.3f, submit %.3f, render %.3f), %d vtx, %d draw calls, %.2f allocs/frame\n",
+            result.TimeTotal.Avg(), result.TimeNewFrame.Avg(), result.TimeSubmit.Avg(), result.TimeRender.Avg(), result.VtxCount, result.DrawCalls, result.Allocs.Avg());
+    }
+    fprintf(f, "\n  ]\n}\n");
+    if (f != stdout)
+        fclose(f);
+    return 0;
+}
@@ -45,6 +45,7 @@
 //#define IMGUI_ENABLE_OSX_DEFAULT_CLIPBOARD_FUNCTIONS      // [OSX] Implement default OSX clipboard handler (need to link with '-framework ApplicationServices', this is why this is not the default).
 //#define IMGUI_DISABLE_DEFAULT_SHELL_FUNCTIONS             // Don't implement default platform_io.Platform_OpenInShellFn() handler (Win32: ShellExecute(), require shell32.lib/.a, Mac/Linux: use system("")).
 //#define IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS            // Don't implement ImFormatString/ImFormatStringV so you can implement them yourself (e.g. if you don't want to link with vsnprintf)
+//#define IMGUI_DISABLE_FAST_NUMBER_FORMAT                  // Don't format simple numeric formats (e.g. "%d", "%.3f") without vsnprintf() in Text() and scalar widgets. Implied by IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS.
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
@@ -138,6 +139,12 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Enable built-in profiler zones in NewFrame(), Begin(), End(), Render(), tables layout, text rendering etc.
+// Timings are visible in 'Metrics/Debugger->Profiler' and zones may be forwarded to an external profiler with ImGui::ProfilerSetHooks().
+// When not defined, IMGUI_PROFILER_ZONE() markers compile to nothing.
+//#define IMGUI_ENABLE_PROFILER
+//#define IMGUI_PROFILER_RECORDS_CAPACITY 4096                // Size of the per-context ring buffer of recorded zones.
+
 //---- Tip: You can add extra functions within the ImGui:: namespace from anywhere (e.g. your own sources/header files)
 /*
 namespace ImGui
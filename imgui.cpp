@@ -73,7 +73,7 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextLog
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -96,6 +96,7 @@ CODE
 // [SECTION] LOCALIZATION
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] PROFILER
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
@@ -1345,6 +1346,9 @@ static const char*      Platform_GetClipboardTextFn_DefaultImpl(ImGuiContext* ct
 static void             Platform_SetClipboardTextFn_DefaultImpl(ImGuiContext* ctx, const char* text);
 static void             Platform_SetImeDataFn_DefaultImpl(ImGuiContext* ctx, ImGuiViewport* viewport, ImGuiPlatformImeData* data);
 static bool             Platform_OpenInShellFn_DefaultImpl(ImGuiContext* ctx, const char* path);
+#ifdef IMGUI_ENABLE_PROFILER
+static ImU64            Platform_GetTimeNsFn_DefaultImpl(ImGuiContext* ctx);
+#endif
 
 namespace ImGui
 {
@@ -1355,6 +1359,11 @@ static void             ItemHandleShortcut(ImGuiID id);
 static int              FindWindowFocusIndex(ImGuiWindow* window);
 static void             UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_created, ImGuiWindowFlags new_flags);
 
+// Window Hit Grid
+static void             UpdateWindowsHitGridNewFrame();
+static void             UpdateWindowInHitGrid(ImGuiWindow* window);
+static void             RemoveWindowFromHitGrid(ImGuiWindow* window);
+
 // Navigation
 static void             NavUpdate();
 static void             NavUpdateWindowing();
@@ -1642,12 +1651,15 @@ ImGuiIO::ImGuiIO()
     ConfigInputTrickleEventQueue = true;
     ConfigInputTextCursorBlink = true;
     ConfigInputTextEnterKeepActive = false;
+    ConfigInputTextUndoMemoryBudget = 0;
+    ConfigInputTextUndoCompress = false;
     ConfigDragClickToInputText = false;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactDrawLists = true;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -2216,13 +2228,50 @@ const char* ImStrbol(const char* buf_mid_line, const char* buf_begin) // find be
     return buf_mid_line;
 }
 
+#ifdef IMGUI_ENABLE_SSE2
+static inline __m128i ImToUpperSSE2(__m128i v)
+{
+    const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1))); // Signed compare: >= 0x80 bytes are not in range
+    return _mm_andnot_si128(_mm_and_si128(is_lower, _mm_set1_epi8(0x20)), v);
+}
+#endif
+
+// Case-insensitive for ASCII characters.
+// With SSE2: compare first and last characters of needle for 16 positions at a time, and only compare whole needle on candidates.
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + ImStrlen(needle);
+    if (!haystack_end)
+        haystack_end = haystack + ImStrlen(haystack);
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len == 0 || haystack_end - haystack < needle_len)
+        return NULL;
+    const char* haystack_last = haystack_end - needle_len; // Last possible match position
 
     const char un0 = (char)ImToUpper(*needle);
-    while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
+#ifdef IMGUI_ENABLE_SSE2
+    const __m128i v_first = _mm_set1_epi8(un0);
+    const __m128i v_last = _mm_set1_epi8((char)ImToUpper(needle_end[-1]));
+    for (; haystack_last - haystack >= 15; haystack += 16)
+    {
+        const __m128i eq_first = _mm_cmpeq_epi8(v_first, ImToUpperSSE2(_mm_loadu_si128((const __m128i*)(const void*)haystack)));
+        const __m128i eq_last = _mm_cmpeq_epi8(v_last, ImToUpperSSE2(_mm_loadu_si128((const __m128i*)(const void*)(haystack + needle_len - 1))));
+        for (unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last)), bit = 0; mask != 0; mask >>= 1, bit++)
+        {
+            if ((mask & 1) == 0)
+                continue;
+            const char* a = haystack + bit + 1;
+            const char* b = needle + 1;
+            for (; b < needle_end - 1; a++, b++)
+                if (ImToUpper(*a) != ImToUpper(*b))
+                    break;
+            if (b >= needle_end - 1)
+                return haystack + bit;
+        }
+    }
+#endif
+    for (; haystack <= haystack_last; haystack++)
     {
         if (ImToUpper(*haystack) == un0)
         {
@@ -2233,7 +2282,6 @@ const char* ImStristr(const char* haystack, const char* haystack_end, const char
             if (b == needle_end)
                 return haystack;
         }
-        haystack++;
     }
     return NULL;
 }
@@ -2285,6 +2333,16 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
+// On some platform vsnprintf() takes va_list by reference and modifies it.
+// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
+#ifndef va_copy
+#if defined(__GNUC__) || defined(__clang__)
+#define va_copy(dest, src) __builtin_va_copy(dest, src)
+#else
+#define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
 int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
@@ -2356,12 +2414,326 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
     else
     {
-        int buf_len = ImFormatStringV(g.TempBuffer.Data, g.TempBuffer.Size, fmt, args);
+        // Skip vsnprintf() for simple formats e.g. "%d", "%.3f", "%s: %d" (very common in tables)
+        va_list args_copy;
+        va_copy(args_copy, args);
+        int buf_len = ImFormatStringFastV(g.TempBuffer.Data, g.TempBuffer.Size, fmt, args_copy);
+        va_end(args_copy);
+        if (buf_len < 0)
+            buf_len = ImFormatStringV(g.TempBuffer.Data, g.TempBuffer.Size, fmt, args);
         *out_buf = g.TempBuffer.Data;
         if (out_buf_end) { *out_buf_end = g.TempBuffer.Data + buf_len; }
     }
 }
 
+// Decimal point output by vsnprintf(), or 0 if it isn't a single ASCII character.
+static char ImFormatNumberGetDecimalPoint()
+{
+#ifdef IMGUI_USE_STB_SPRINTF
+    return '.';
+#else
+    ImGuiContext* ctx = GImGui;
+    const ImWchar decimal_point = ctx ? ctx->PlatformIO.Platform_LocaleDecimalPoint : (ImWchar)'.';
+    return (decimal_point == 0 || decimal_point >= 0x80) ? 0 : (char)decimal_point;
+#endif
+}
+
+// Parse a conversion specification (after its '%'): [-0 flags][width][.precision][ll]type. Type is not validated.
+// Return pointer after type character, or NULL if it uses anything else (other flags, '*', other length modifiers, large width or precision).
+static const char* ImParseFormatNumberSpec(const char* p, ImGuiNumberFormat* out_nf)
+{
+    out_nf->LeftAlign = out_nf->ZeroPad = false;
+    for (;; p++)
+        if (*p == '-')
+            out_nf->LeftAlign = true;
+        else if (*p == '0')
+            out_nf->ZeroPad = true;
+        else
+            break;
+    int width = 0;
+    for (; *p >= '0' && *p <= '9'; p++)
+        if ((width = width * 10 + (*p - '0')) > 64)
+            return NULL;
+    int precision = -1;
+    if (*p == '.')
+    {
+        precision = 0;
+        for (p++; *p >= '0' && *p <= '9'; p++)
+            if ((precision = precision * 10 + (*p - '0')) > 127)
+                return NULL;
+    }
+    out_nf->Is64 = (p[0] == 'l' && p[1] == 'l');
+    if (out_nf->Is64)
+        p += 2;
+    out_nf->Type = *p++;
+    out_nf->Width = (ImS8)width;
+    out_nf->Precision = (ImS8)precision;
+    out_nf->Prefix = out_nf->PrefixEnd = out_nf->Suffix = out_nf->SuffixEnd = NULL;
+    return p;
+}
+
+// Validate a conversion specification parsed by ImParseFormatNumberSpec() for ImFormatNumberInt()/ImFormatNumberFloat().
+static bool ImParseFormatNumberValidateSpec(ImGuiNumberFormat* nf)
+{
+    switch (nf->Type)
+    {
+    case 'd': case 'i': case 'u': case 'x': case 'X':
+        if (nf->Precision != -1) // "%.3d" means minimum digits, not supported
+            return false;
+        if (nf->Type == 'i')
+            nf->Type = 'd';
+        break;
+    case 'f':
+        if (nf->Is64 || nf->Precision > 15) // Keep 10^precision and rounded values exact in double/ImU64 arithmetic
+            return false;
+        if (nf->Precision == -1)
+            nf->Precision = 6;
+        if ((nf->DecimalPoint = ImFormatNumberGetDecimalPoint()) == 0)
+            return false;
+        break;
+    default:
+        return false;
+    }
+    if (nf->LeftAlign)
+        nf->ZeroPad = false;
+    return true;
+}
+
+// Parse formats which ImFormatNumberInt()/ImFormatNumberFloat() can output exactly like vsnprintf() would.
+// Anything else (flags other than '-'/'0', other types, "%%" in decorations, non-ASCII decimal point) returns false.
+bool ImParseFormatNumber(const char* fmt, ImGuiNumberFormat* out_nf)
+{
+#if defined(IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS) || defined(IMGUI_DISABLE_FAST_NUMBER_FORMAT)
+    IM_UNUSED(fmt);
+    IM_UNUSED(out_nf);
+    return false;
+#else
+    const char* p = fmt;
+    while (*p != 0 && *p != '%')
+        p++;
+    if (*p != '%')
+        return false;
+    const char* prefix_end = p++;
+    if ((p = ImParseFormatNumberSpec(p, out_nf)) == NULL || !ImParseFormatNumberValidateSpec(out_nf))
+        return false;
+    out_nf->Prefix = fmt;
+    out_nf->PrefixEnd = prefix_end;
+
+    out_nf->Suffix = p;
+    while (*p != 0 && *p != '%')
+        p++;
+    if (*p == '%')
+        return false;
+    out_nf->SuffixEnd = p;
+    return true;
+#endif
+}
+
+// Output decorations around digits, padding to Width, truncating and zero-terminating like ImFormatString() does.
+static int ImFormatNumberWithDecorations(char* buf, size_t buf_size, const ImGuiNumberFormat* nf, const char* digits, const char* digits_end)
+{
+    static const char spaces[] = "                                                                "; // 64
+    static const char zeros[]  = "0000000000000000000000000000000000000000000000000000000000000000"; // 64
+    if (buf_size == 0)
+        return 0;
+    const char* sign = digits;
+    if (*digits == '-')
+        digits++;
+    const int pad = ImMax(nf->Width - (int)(digits_end - sign), 0);
+    const char* pad_left = (nf->LeftAlign || nf->ZeroPad) ? spaces + 64 : spaces + 64 - pad;
+    const char* pad_zeros = nf->ZeroPad ? zeros + 64 - pad : zeros + 64;
+    const char* pad_right = nf->LeftAlign ? spaces + 64 - pad : spaces + 64;
+
+    char* out = buf;
+    char* out_end = buf + buf_size - 1;
+    const char* parts[7][2] = { { nf->Prefix, nf->PrefixEnd }, { pad_left, spaces + 64 }, { sign, digits }, { pad_zeros, zeros + 64 }, { digits, digits_end }, { pad_right, spaces + 64 }, { nf->Suffix, nf->SuffixEnd } };
+    for (int part_n = 0; part_n < 7; part_n++)
+    {
+        const size_t len = ImMin((size_t)(parts[part_n][1] - parts[part_n][0]), (size_t)(out_end - out));
+        if (len > 0)
+            memcpy(out, parts[part_n][0], len);
+        out += len;
+    }
+    *out = 0;
+    return (int)(out - buf);
+}
+
+// Write digits of 'v' backward, ending at 'p'. Return pointer to first digit.
+static char* ImFormatNumberWriteDigitsBackward(char* p, ImU64 v, int min_digits)
+{
+    do
+    {
+        *--p = (char)('0' + (int)(v % 10));
+        v /= 10;
+        min_digits--;
+    } while (v != 0 || min_digits > 0);
+    return p;
+}
+
+int ImFormatNumberInt(char* buf, size_t buf_size, const ImGuiNumberFormat* nf, ImU64 v)
+{
+    IM_ASSERT(nf->Type == 'd' || nf->Type == 'u' || nf->Type == 'x' || nf->Type == 'X');
+    char tmp[24];
+    char* tmp_end = tmp + IM_COUNTOF(tmp);
+    char* p;
+    bool negative = false;
+    if (nf->Type == 'd')
+    {
+        const ImS64 sv = nf->Is64 ? (ImS64)v : (ImS64)(ImS32)(ImU32)v;
+        negative = sv < 0;
+        p = ImFormatNumberWriteDigitsBackward(tmp_end, negative ? (ImU64)0 - (ImU64)sv : (ImU64)sv, 1);
+    }
+    else if (nf->Type == 'u')
+    {
+        p = ImFormatNumberWriteDigitsBackward(tmp_end, nf->Is64 ? v : (ImU64)(ImU32)v, 1);
+    }
+    else
+    {
+        const char* hex_digits = (nf->Type == 'x') ? "0123456789abcdef" : "0123456789ABCDEF";
+        if (!nf->Is64)
+            v = (ImU32)v;
+        p = tmp_end;
+        do
+        {
+            *--p = hex_digits[v & 0x0F];
+            v >>= 4;
+        } while (v != 0);
+    }
+    if (negative)
+        *--p = '-';
+    return ImFormatNumberWithDecorations(buf, buf_size, nf, p, tmp_end);
+}
+
+// Fixed-point formatting: round v * 10^precision to nearest integer, then print integer and fractional parts.
+// The product is exact within half an ulp, so we only defer to vsnprintf() when it lands too close to a .5 boundary for us
+// to be sure of the rounding direction (including exact ties), or when the value is too large or not finite.
+int ImFormatNumberFloat(char* buf, size_t buf_size, const ImGuiNumberFormat* nf, double v)
+{
+    IM_ASSERT(nf->Type == 'f');
+    static const double pow10_f64[16] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+    static const ImU64 pow10_u64[16] = { 1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+        10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull };
+    ImU64 v_bits;
+    memcpy(&v_bits, &v, sizeof(v));
+    const bool negative = (v_bits >> 63) != 0; // Sign bit, so that -0.0 outputs "-0.000" like vsnprintf()
+    const double scaled = (negative ? -v : v) * pow10_f64[nf->Precision];
+    if (!(scaled < 1e15)) // Also catches NaN and Inf
+        return -1;
+    const ImU64 scaled_int = (ImU64)scaled;
+    const double frac = scaled - (double)scaled_int;
+    const double tie_dist = (frac > 0.5) ? frac - 0.5 : 0.5 - frac;
+    if (tie_dist <= scaled * (1.0 / 4503599627370496.0)) // 2^-52
+        return -1;
+    const ImU64 r = scaled_int + (frac > 0.5 ? 1 : 0);
+
+    char tmp[40];
+    char* tmp_end = tmp + IM_COUNTOF(tmp);
+    char* p = tmp_end;
+    if (nf->Precision > 0)
+    {
+        p = ImFormatNumberWriteDigitsBackward(p, r % pow10_u64[nf->Precision], nf->Precision);
+        *--p = nf->DecimalPoint;
+    }
+    p = ImFormatNumberWriteDigitsBackward(p, r / pow10_u64[nf->Precision], 1);
+    if (negative)
+        *--p = '-';
+    return ImFormatNumberWithDecorations(buf, buf_size, nf, p, tmp_end);
+}
+
+// Format like vsnprintf() would, without calling it, when all conversions are supported: %d %i %u %x %X %f %s %c %%,
+// with optional '-' and '0' flags, width, precision (for %f and %s) and "ll" length modifier.
+// Return -1 when vsnprintf() is required for this format or for one of the values, in which case 'args' should not be reused.
+int ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+#if defined(IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS) || defined(IMGUI_DISABLE_FAST_NUMBER_FORMAT)
+    IM_UNUSED(buf);
+    IM_UNUSED(buf_size);
+    IM_UNUSED(fmt);
+    IM_UNUSED(args);
+    return -1;
+#else
+    if (buf_size == 0)
+        return -1;
+    char* out = buf;
+    char* out_end = buf + buf_size - 1;
+    for (const char* p = fmt; *p != 0; )
+    {
+        // Copy literal text up to next conversion
+        const char* literal_end = p;
+        while (*literal_end != 0 && *literal_end != '%')
+            literal_end++;
+        size_t len = ImMin((size_t)(literal_end - p), (size_t)(out_end - out));
+        memcpy(out, p, len);
+        out += len;
+        if (*literal_end == 0)
+            break;
+        p = literal_end + 1;
+        if (*p == '%')
+        {
+            if (out < out_end)
+                *out++ = '%';
+            p++;
+            continue;
+        }
+
+        ImGuiNumberFormat nf;
+        if ((p = ImParseFormatNumberSpec(p, &nf)) == NULL)
+            return -1;
+        if (nf.Type == 's' || nf.Type == 'c')
+        {
+            // Strings and characters: only '-' flag and width are valid, precision limits string length
+            if (nf.ZeroPad || nf.Is64 || (nf.Type == 'c' && nf.Precision != -1))
+                return -1;
+            char c;
+            const char* s;
+            if (nf.Type == 'c')
+            {
+                c = (char)va_arg(args, int);
+                s = &c;
+                len = 1;
+            }
+            else
+            {
+                if ((s = va_arg(args, const char*)) == NULL) // Output for NULL is implementation-defined
+                    return -1;
+                if (nf.Precision == -1)
+                    len = ImStrlen(s);
+                else if (const char* s_end = (const char*)ImMemchr(s, 0, (size_t)nf.Precision))
+                    len = (size_t)(s_end - s);
+                else
+                    len = (size_t)nf.Precision;
+            }
+            const size_t pad = (nf.Width > (int)len) ? (size_t)nf.Width - len : 0;
+            for (size_t n = 0; n < pad && !nf.LeftAlign && out < out_end; n++)
+                *out++ = ' ';
+            const size_t copy_len = ImMin(len, (size_t)(out_end - out));
+            memcpy(out, s, copy_len);
+            out += copy_len;
+            for (size_t n = 0; n < pad && nf.LeftAlign && out < out_end; n++)
+                *out++ = ' ';
+            continue;
+        }
+
+        // Numbers
+        if (!ImParseFormatNumberValidateSpec(&nf))
+            return -1;
+        const size_t avail = (size_t)(out_end - out) + 1;
+        int w;
+        if (nf.Type == 'f')
+            w = ImFormatNumberFloat(out, avail, &nf, va_arg(args, double));
+        else if (nf.Is64)
+            w = ImFormatNumberInt(out, avail, &nf, (ImU64)va_arg(args, long long));
+        else
+            w = ImFormatNumberInt(out, avail, &nf, (ImU64)va_arg(args, unsigned int));
+        if (w < 0)
+            return -1;
+        out += w;
+    }
+    *out = 0;
+    return (int)(out - buf);
+#endif
+}
+
 #ifndef IMGUI_ENABLE_SSE4_2_CRC
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
@@ -3088,6 +3460,8 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 
     if (text == NULL)
         text = text_end = "";
+    else if (text_end == NULL)
+        text_end = text + ImStrlen(text);
 
     for (const ImGuiTextRange& f : Filters)
     {
@@ -3114,20 +3488,43 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+int ImGuiTextFilter::PassFilterBatch(const char* const* items, int items_count, ImVector<int>* out_indices, int index_base) const
+{
+    const int out_start = out_indices->Size;
+    if (!IsActive())
+    {
+        out_indices->resize(out_start + items_count);
+        for (int n = 0; n < items_count; n++)
+            out_indices->Data[out_start + n] = index_base + n;
+        return items_count;
+    }
+    for (int n = 0; n < items_count; n++)
+        if (PassFilter(items[n]))
+            out_indices->push_back(index_base + n);
+    return out_indices->Size - out_start;
+}
+
+int ImGuiTextFilter::PassFilterBatch(ImGuiTextFilterGetter getter, void* user_data, int idx_begin, int idx_end, ImVector<int>* out_indices) const
+{
+    IM_ASSERT(idx_begin <= idx_end);
+    const int out_start = out_indices->Size;
+    if (!IsActive())
+    {
+        out_indices->resize(out_start + (idx_end - idx_begin));
+        for (int idx = idx_begin; idx < idx_end; idx++)
+            out_indices->Data[out_start + idx - idx_begin] = idx;
+        return idx_end - idx_begin;
+    }
+    for (int idx = idx_begin; idx < idx_end; idx++)
+        if (PassFilter(getter(user_data, idx)))
+            out_indices->push_back(idx);
+    return out_indices->Size - out_start;
+}
+
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextLog
 //-----------------------------------------------------------------------------
 
-// On some platform vsnprintf() takes va_list by reference and modifies it.
-// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
-#ifndef va_copy
-#if defined(__GNUC__) || defined(__clang__)
-#define va_copy(dest, src) __builtin_va_copy(dest, src)
-#else
-#define va_copy(dest, src) (dest = src)
-#endif
-#endif
-
 char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
@@ -3199,6 +3596,242 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
 }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
+//-----------------------------------------------------------------------------
+// ImGuiTextLog
+//-----------------------------------------------------------------------------
+
+ImGuiTextLog::ImGuiTextLog()
+{
+    ChunkSize = 64 * 1024;
+    MaxSize = 0;
+    AutoScroll = true;
+    LockFunc = NULL;
+    LockUserData = NULL;
+    _FreeChunk = NULL;
+    _Size = _LinesCount = _LinesDropped = 0;
+    _ViewWindowID = 0;
+    _ViewLinesDropped = _ViewLinesCount = 0;
+}
+
+static void ImGuiTextLog_FreeChunk(ImGuiTextLogChunk* chunk)
+{
+    chunk->~ImGuiTextLogChunk();
+    IM_FREE(chunk);
+}
+
+ImGuiTextLog::~ImGuiTextLog()
+{
+    clear();
+    if (_FreeChunk)
+        ImGuiTextLog_FreeChunk(_FreeChunk);
+}
+
+void ImGuiTextLog::clear()
+{
+    if (LockFunc)
+        LockFunc(LockUserData, true);
+    _Pending.clear();
+    if (LockFunc)
+        LockFunc(LockUserData, false);
+    _PendingFlush.clear();
+    for (ImGuiTextLogChunk* chunk : Chunks)
+        ImGuiTextLog_FreeChunk(chunk);
+    Chunks.clear();
+    _Size = _LinesCount = _LinesDropped = 0;
+}
+
+// Reuse last dropped chunk when possible, so a log running in ring mode doesn't allocate.
+static ImGuiTextLogChunk* ImGuiTextLog_AllocChunk(ImGuiTextLog* log, int capacity)
+{
+    ImGuiTextLogChunk* chunk = log->_FreeChunk;
+    log->_FreeChunk = NULL;
+    if (chunk != NULL && chunk->Capacity != capacity)
+    {
+        ImGuiTextLog_FreeChunk(chunk);
+        chunk = NULL;
+    }
+    if (chunk == NULL)
+    {
+        chunk = (ImGuiTextLogChunk*)IM_ALLOC(sizeof(ImGuiTextLogChunk) + (size_t)capacity);
+        IM_PLACEMENT_NEW(chunk) ImGuiTextLogChunk();
+        chunk->Capacity = capacity;
+    }
+    chunk->Size = 0;
+    chunk->FirstLine = 0;
+    chunk->LineOffsets.resize(0);
+    return chunk;
+}
+
+static void ImGuiTextLog_RecycleChunk(ImGuiTextLog* log, ImGuiTextLogChunk* chunk)
+{
+    if (log->_FreeChunk == NULL && chunk->Capacity == log->ChunkSize)
+        log->_FreeChunk = chunk;
+    else
+        ImGuiTextLog_FreeChunk(chunk);
+}
+
+// Store text one line at a time. A line never spans two chunks: when the last (open) line of last chunk doesn't fit, it is moved to a new chunk.
+static void ImGuiTextLog_Ingest(ImGuiTextLog* log, const char* str, const char* str_end)
+{
+    IM_ASSERT(log->ChunkSize > 0);
+    while (str < str_end)
+    {
+        const char* seg_end = (const char*)ImMemchr(str, '\n', (size_t)(str_end - str));
+        seg_end = seg_end ? seg_end + 1 : str_end;
+        const int seg_len = (int)(seg_end - str);
+
+        ImGuiTextLogChunk* chunk = log->Chunks.Size ? log->Chunks.back() : NULL;
+        if (chunk == NULL || chunk->Size + seg_len > chunk->Capacity)
+        {
+            // Move open line (if any) to a new chunk. Lines bigger than ChunkSize get a bigger chunk.
+            const bool line_open = chunk && chunk->Data()[chunk->Size - 1] != '\n';
+            const int carry_off = line_open ? chunk->LineOffsets.back() : 0;
+            const int carry_len = line_open ? chunk->Size - carry_off : 0;
+            const int needed = carry_len + seg_len;
+            ImGuiTextLogChunk* new_chunk = ImGuiTextLog_AllocChunk(log, (needed <= log->ChunkSize) ? log->ChunkSize : needed + needed / 2);
+            new_chunk->FirstLine = chunk ? chunk->FirstLine + chunk->LineOffsets.Size - (line_open ? 1 : 0) : log->_LinesDropped;
+            if (line_open)
+            {
+                memcpy(new_chunk->Data(), chunk->Data() + carry_off, (size_t)carry_len);
+                new_chunk->Size = carry_len;
+                new_chunk->LineOffsets.push_back(0);
+                chunk->Size = carry_off;
+                chunk->LineOffsets.pop_back();
+                if (chunk->Size == 0)
+                {
+                    log->Chunks.pop_back();
+                    ImGuiTextLog_RecycleChunk(log, chunk);
+                }
+            }
+            log->Chunks.push_back(new_chunk);
+            chunk = new_chunk;
+        }
+
+        char* data = chunk->Data();
+        if (chunk->Size == 0 || data[chunk->Size - 1] == '\n')
+        {
+            chunk->LineOffsets.push_back(chunk->Size);
+            log->_LinesCount++;
+        }
+        memcpy(data + chunk->Size, str, (size_t)seg_len);
+        chunk->Size += seg_len;
+        log->_Size += seg_len;
+        str = seg_end;
+    }
+
+    // Ring mode: drop oldest chunks. Only the last chunk may have an open line, so dropped chunks only contain whole lines.
+    int drop_count = 0;
+    int drop_size = log->_Size;
+    while (log->MaxSize > 0 && drop_size > log->MaxSize && drop_count + 1 < log->Chunks.Size)
+    {
+        ImGuiTextLogChunk* chunk = log->Chunks[drop_count++];
+        drop_size -= chunk->Size;
+        log->_LinesCount -= chunk->LineOffsets.Size;
+        log->_LinesDropped += chunk->LineOffsets.Size;
+        ImGuiTextLog_RecycleChunk(log, chunk);
+    }
+    if (drop_count > 0)
+        log->Chunks.erase(log->Chunks.Data, log->Chunks.Data + drop_count);
+    log->_Size = drop_size;
+}
+
+void ImGuiTextLog::append(const char* str, const char* str_end)
+{
+    if (str_end == NULL)
+        str_end = str + ImStrlen(str);
+    if (str == str_end)
+        return;
+    if (LockFunc == NULL)
+    {
+        ImGuiTextLog_Ingest(this, str, str_end);
+        return;
+    }
+    LockFunc(LockUserData, true);
+    const int write_off = _Pending.Size;
+    const int len = (int)(str_end - str);
+    if (write_off + len > _Pending.Capacity)
+        _Pending.reserve(ImMax(_Pending.Capacity * 2, write_off + len));
+    _Pending.resize(write_off + len);
+    memcpy(_Pending.Data + write_off, str, (size_t)len);
+    LockFunc(LockUserData, false);
+}
+
+void ImGuiTextLog::appendf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    appendfv(fmt, args);
+    va_end(args);
+}
+
+// Format outside of lock, in a stack buffer when possible.
+void ImGuiTextLog::appendfv(const char* fmt, va_list args)
+{
+    va_list args_copy;
+    va_copy(args_copy, args);
+
+    char local_buf[1024];
+    int len = ImFormatStringV(local_buf, IM_COUNTOF(local_buf), fmt, args);
+    if (len < IM_COUNTOF(local_buf) - 1)
+    {
+        append(local_buf, local_buf + len);
+        va_end(args_copy);
+        return;
+    }
+
+    // Didn't fit: format again in a heap buffer of the right size
+    va_list args_copy2;
+    va_copy(args_copy2, args_copy);
+    len = ImFormatStringV(NULL, 0, fmt, args_copy);
+    va_end(args_copy);
+    if (len > 0)
+    {
+        char* heap_buf = (char*)IM_ALLOC((size_t)len + 1);
+        ImFormatStringV(heap_buf, (size_t)len + 1, fmt, args_copy2);
+        append(heap_buf, heap_buf + len);
+        IM_FREE(heap_buf);
+    }
+    va_end(args_copy2);
+}
+
+void ImGuiTextLog::Flush()
+{
+    if (LockFunc)
+        LockFunc(LockUserData, true);
+    _Pending.swap(_PendingFlush);
+    if (LockFunc)
+        LockFunc(LockUserData, false);
+    if (_PendingFlush.Size > 0)
+        ImGuiTextLog_Ingest(this, _PendingFlush.Data, _PendingFlush.Data + _PendingFlush.Size);
+    _PendingFlush.resize(0);
+}
+
+const char* ImGuiTextLog::GetLine(int line_n, const char** out_line_end) const
+{
+    IM_ASSERT(line_n >= 0 && line_n < _LinesCount);
+    const int abs_line_n = _LinesDropped + line_n;
+
+    // Find last chunk with FirstLine <= abs_line_n
+    int lo = 0, hi = Chunks.Size - 1;
+    while (lo < hi)
+    {
+        int mid = (lo + hi + 1) / 2;
+        if (Chunks[mid]->FirstLine <= abs_line_n)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    ImGuiTextLogChunk* chunk = Chunks[lo];
+    const int idx = abs_line_n - chunk->FirstLine;
+    IM_ASSERT(idx >= 0 && idx < chunk->LineOffsets.Size);
+    const char* line_begin = chunk->Data() + chunk->LineOffsets[idx];
+    const char* line_end = chunk->Data() + ((idx + 1 < chunk->LineOffsets.Size) ? chunk->LineOffsets[idx + 1] : chunk->Size);
+    if (line_end > line_begin && line_end[-1] == '\n')
+        line_end--;
+    *out_line_end = line_end;
+    return line_begin;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -3235,7 +3868,8 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(ImGuiListClipper* clipper, float pos_y, float line_height)
+// 'row_increase' < 0: infer number of table rows skipped from distance and line height.
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(ImGuiListClipper* clipper, float pos_y, float line_height, int row_increase = -1)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
@@ -3253,7 +3887,8 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(ImGuiListClipper* clippe
     {
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
+        if (row_increase < 0)
+            row_increase = (int)((off_y / line_height) + 0.5f);
         if (row_increase > 0 && (clipper->Flags & ImGuiListClipperFlags_NoSetTableRowCounters) == 0) // If your clipper item height is != from actual table row height, consider using ImGuiListClipperFlags_NoSetTableRowCounters. See #8886.
         {
             table->CurrentRow += row_increase;
@@ -3263,6 +3898,8 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(ImGuiListClipper* clippe
     }
 }
 
+static void ImGuiListClipper_SeekCursorForItemEx(ImGuiListClipper* clipper, int item_n, int row_increase);
+
 ImGuiListClipper::ImGuiListClipper()
 {
     memset((void*)this, 0, sizeof(*this));
@@ -3288,6 +3925,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
     ItemsCount = items_count;
+    ItemsHeights = NULL;
     DisplayStart = -1;
     DisplayEnd = 0;
 
@@ -3301,6 +3939,17 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartSeekOffsetY = data->LossynessOffset;
 }
 
+void ImGuiListClipper::BeginWithHeights(int items_count, ImGuiListClipperHeights* items_heights)
+{
+    IM_ASSERT(items_heights != NULL);
+    IM_ASSERT(items_count >= 0 && items_count < INT_MAX && "BeginWithHeights() requires a known number of items.");
+    if (items_heights->DefaultHeight <= 0.0f)
+        items_heights->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+    items_heights->Resize(items_count);
+    Begin(items_count, items_heights->DefaultHeight); // Known height: skip measuring first item.
+    ItemsHeights = items_heights;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -3309,7 +3958,12 @@ void ImGuiListClipper::End()
         ImGuiContext& g = *Ctx;
         IMGUI_DEBUG_LOG_CLIPPER("Clipper: End() in '%s'\n", g.CurrentWindow->Name);
         if (ItemsCount >= 0 && ItemsCount < INT_MAX && DisplayStart >= 0)
-            SeekCursorForItem(ItemsCount);
+        {
+            if (ItemsHeights != NULL)
+                ImGuiListClipper_SeekCursorForItemEx(this, ItemsCount, ItemsCount - DisplayEnd);
+            else
+                SeekCursorForItem(ItemsCount);
+        }
 
         // Restore temporary buffer and fix back pointers which may be invalidated when nesting
         IM_ASSERT(data->ListClipper == this);
@@ -3338,11 +3992,31 @@ void ImGuiListClipper::IncludeItemsByIndex(int item_begin, int item_end)
 // The ONLY reason you may want to call this is if you passed INT_MAX to ImGuiListClipper::Begin() because you couldn't step item count beforehand.
 void ImGuiListClipper::SeekCursorForItem(int item_n)
 {
+    ImGuiListClipper_SeekCursorForItemEx(this, item_n, -1);
+}
+
+// 'row_increase' is only used with variable heights, where it cannot be inferred from distance.
+static void ImGuiListClipper_SeekCursorForItemEx(ImGuiListClipper* clipper, int item_n, int row_increase)
+{
+    if (ImGuiListClipperHeights* heights = clipper->ItemsHeights)
+    {
+        // Variable heights: position is the sum of heights of previous items.
+        float pos_y = (float)((double)clipper->StartPosY + clipper->StartSeekOffsetY + heights->GetOffset(item_n));
+        float line_height = (item_n > 0) ? heights->Heights[item_n - 1] : heights->DefaultHeight;
+        if (row_increase < 0)
+        {
+            double cursor_offset = (double)GImGui->CurrentWindow->DC.CursorPos.y - clipper->StartPosY - clipper->StartSeekOffsetY;
+            row_increase = item_n - heights->FindItemAtOffset(cursor_offset + heights->DefaultHeight * 0.5f);
+        }
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(clipper, pos_y, line_height, ImMax(row_increase, 0));
+        return;
+    }
+
     // - Perform the add and multiply with double to allow seeking through larger ranges.
     // - StartPosY starts from ItemsFrozen, by adding SeekOffsetY we generally cancel that out (SeekOffsetY == LossynessOffset - ItemsFrozen * ItemsHeight).
     // - The reason we store SeekOffsetY instead of inferring it, is because we want to allow user to perform Seek after the last step, where ImGuiListClipperData is already done.
-    float pos_y = (float)((double)StartPosY + StartSeekOffsetY + (double)item_n * ItemsHeight);
-    ImGuiListClipper_SeekCursorAndSetupPrevLine(this, pos_y, ItemsHeight);
+    float pos_y = (float)((double)clipper->StartPosY + clipper->StartSeekOffsetY + (double)item_n * clipper->ItemsHeight);
+    ImGuiListClipper_SeekCursorAndSetupPrevLine(clipper, pos_y, clipper->ItemsHeight);
 }
 
 static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
@@ -3356,6 +4030,20 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Variable heights: measure height of item submitted since last step
+    ImGuiListClipperHeights* heights = clipper->ItemsHeights;
+    if (heights != NULL && data->MeasureItemIdx >= 0)
+    {
+        float item_height;
+        if (ImIsFloatAboveGuaranteedIntegerPrecision(data->MeasureStartPosY) || ImIsFloatAboveGuaranteedIntegerPrecision(window->DC.CursorPos.y))
+            item_height = window->DC.PrevLineSize.y + g.Style.ItemSpacing.y; // Mitigation for very large range, see below.
+        else
+            item_height = window->DC.CursorPos.y - data->MeasureStartPosY;
+        if (item_height > 0.0f)
+            heights->SetHeight(data->MeasureItemIdx, item_height);
+        data->MeasureItemIdx = -1;
+    }
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
         return false;
@@ -3421,7 +4109,10 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (calc_clipping)
     {
         // Record seek offset, this is so ImGuiListClipper::Seek() can be called after ImGuiListClipperData is done
-        clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
+        if (heights != NULL)
+            clipper->StartSeekOffsetY = (double)data->LossynessOffset - heights->GetOffset(data->ItemsFrozen);
+        else
+            clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
 
         if (g.LogEnabled)
         {
@@ -3476,35 +4167,57 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
+        // - With variable heights, we lookup items in the prefix sum of heights, relative to the top of the list.
         for (ImGuiListClipperRange& range : data->Ranges)
             if (range.PosToIndexConvert)
             {
-                int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
-                int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
-                range.Min = ImClamp(already_submitted + m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
-                range.Max = ImClamp(already_submitted + m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
+                int n1, n2;
+                if (heights != NULL)
+                {
+                    n1 = heights->FindItemAtOffset((double)range.Min - clipper->StartPosY - clipper->StartSeekOffsetY);
+                    n2 = heights->FindItemAtOffset((double)range.Max - clipper->StartPosY - clipper->StartSeekOffsetY) + 1;
+                }
+                else
+                {
+                    n1 = already_submitted + (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
+                    n2 = already_submitted + (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                }
+                range.Min = ImClamp(n1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
+                range.Max = ImClamp(n2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
                 range.PosToIndexConvert = false;
             }
         ImGuiListClipper_SortAndFuseRanges(data->Ranges, data->StepNo);
     }
 
     // Step 0+ (if item height is given in advance) or 1+: Display the next range in line.
+    // With variable heights, display items one at a time so each of them can be measured.
     while (data->StepNo < data->Ranges.Size)
     {
         clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
+        if (heights != NULL && clipper->DisplayEnd > clipper->DisplayStart + 1)
+        {
+            // Split range, remainder will be processed by next step.
+            data->Ranges.insert(data->Ranges.Data + data->StepNo + 1, ImGuiListClipperRange::FromIndices(clipper->DisplayStart + 1, clipper->DisplayEnd));
+            clipper->DisplayEnd = clipper->DisplayStart + 1;
+        }
         data->StepNo++;
         if (clipper->DisplayStart >= clipper->DisplayEnd)
             continue;
         if (clipper->DisplayStart > already_submitted)
-            clipper->SeekCursorForItem(clipper->DisplayStart);
+            ImGuiListClipper_SeekCursorForItemEx(clipper, clipper->DisplayStart, clipper->DisplayStart - already_submitted);
+        if (heights != NULL)
+        {
+            data->MeasureItemIdx = clipper->DisplayStart;
+            data->MeasureStartPosY = window->DC.CursorPos.y;
+        }
         return true;
     }
 
     // After the last step: Let the clipper validate that we have reached the expected Y position (corresponding to element DisplayEnd),
     // Advance the cursor to the end of the list and then returns 'false' to end the loop.
     if (clipper->ItemsCount < INT_MAX)
-        clipper->SeekCursorForItem(clipper->ItemsCount);
+        ImGuiListClipper_SeekCursorForItemEx(clipper, clipper->ItemsCount, clipper->ItemsCount - already_submitted);
 
     return false;
 }
@@ -3539,6 +4252,95 @@ void ImGui::CalcClipRectVisibleItemsY(const ImRect& clip_rect, const ImVec2& pos
     *out_visible_end = ImMax((int)ImCeil((clip_rect.Max.y - pos.y) / items_height), *out_visible_start);
 }
 
+// Fenwick tree (binary indexed tree): node n (stored in Tree[n-1]) holds the sum of heights of items [n - lowbit(n), n).
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    if (items_count <= Heights.Size)
+    {
+        // Removing trailing items doesn't affect remaining nodes
+        Heights.resize(items_count);
+        Tree.resize(items_count);
+        return;
+    }
+
+    // Appending: each new node sums its children, which are all already present. O(log N) per item.
+    Heights.reserve(items_count);
+    Tree.reserve(items_count);
+    for (int n = Heights.Size + 1; n <= items_count; n++)
+    {
+        double sum = DefaultHeight;
+        for (int child_n = n - 1; child_n > n - (n & -n); child_n -= (child_n & -child_n))
+            sum += Tree[child_n - 1];
+        Heights.push_back(DefaultHeight);
+        Tree.push_back(sum);
+    }
+}
+
+void ImGuiListClipperHeights::Build(int items_count, float (*get_height_func)(void* user_data, int item_n), void* user_data)
+{
+    IM_ASSERT(items_count >= 0 && get_height_func != NULL);
+    Heights.resize(items_count);
+    Tree.resize(items_count);
+    for (int item_n = 0; item_n < items_count; item_n++)
+        Tree[item_n] = Heights[item_n] = get_height_func(user_data, item_n);
+    for (int n = 1; n <= items_count; n++)
+    {
+        int parent_n = n + (n & -n);
+        if (parent_n <= items_count)
+            Tree[parent_n - 1] += Tree[n - 1];
+    }
+}
+
+void ImGuiListClipperHeights::SetHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    const double delta = (double)height - Heights[item_n];
+    if (delta == 0.0)
+        return;
+    Heights[item_n] = height;
+    for (int n = item_n + 1; n <= Tree.Size; n += (n & -n))
+        Tree[n - 1] += delta;
+}
+
+void ImGuiListClipperHeights::SetAllHeights(float height)
+{
+    const int items_count = Heights.Size;
+    for (int n = 1; n <= items_count; n++)
+    {
+        Heights[n - 1] = height;
+        Tree[n - 1] = (double)height * (n & -n);
+    }
+}
+
+double ImGuiListClipperHeights::GetOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Tree.Size);
+    double offset = 0.0;
+    for (int n = item_n; n > 0; n -= (n & -n))
+        offset += Tree[n - 1];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    // Find largest item count whose total height is <= offset, by descending the implicit tree.
+    const int items_count = Tree.Size;
+    if (items_count == 0)
+        return 0;
+    int n = 0;
+    int step = 1;
+    while (step * 2 <= items_count)
+        step *= 2;
+    for (; step > 0; step >>= 1)
+        if (n + step <= items_count && Tree[n + step - 1] <= offset)
+        {
+            n += step;
+            offset -= Tree[n - 1];
+        }
+    return ImMin(n, items_count - 1);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -4335,6 +5137,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     LogWindow = NULL;
     LogNextPrefix = LogNextSuffix = NULL;
     LogFile = NULL;
+    LogCallback = NULL;
+    LogCallbackUserData = NULL;
     LogLinePosY = FLT_MAX;
     LogDepthRef = 0;
     LogDepthToExpand = LogDepthToExpandDefault = 2;
@@ -4400,6 +5204,13 @@ void ImGui::Initialize()
     // Setup default localization table
     LocalizeRegisterEntries(GLocalizationEntriesEnUS, IM_COUNTOF(GLocalizationEntriesEnUS));
 
+#ifdef IMGUI_ENABLE_PROFILER
+    // Allocate profiler ring buffer upfront, setup default clock
+    ImGuiProfilerRecord empty_record = {};
+    g.Profiler.Records.resize(IMGUI_PROFILER_RECORDS_CAPACITY, empty_record);
+    g.PlatformIO.Platform_GetTimeNsFn = Platform_GetTimeNsFn_DefaultImpl;
+#endif
+
     // Setup default ImGuiPlatformIO clipboard/IME handlers.
     g.PlatformIO.Platform_GetClipboardTextFn = Platform_GetClipboardTextFn_DefaultImpl;    // Platform dependent default implementations
     g.PlatformIO.Platform_SetClipboardTextFn = Platform_SetClipboardTextFn_DefaultImpl;
@@ -4444,6 +5255,7 @@ void ImGui::Shutdown()
     ImGuiContext& g = *GImGui;
     IM_ASSERT_USER_ERROR(g.IO.BackendPlatformUserData == NULL, "Forgot to shutdown Platform backend?");
     IM_ASSERT_USER_ERROR(g.IO.BackendRendererUserData == NULL, "Forgot to shutdown Renderer backend?");
+    g.DebugAllocInfo.SteadyState = false; // Don't report allocations made while shutting down
 
     // The fonts atlas can be used prior to calling NewFrame(), so we clear it even if g.Initialized is FALSE (which would happen if we never called NewFrame)
     for (ImFontAtlas* atlas : g.FontAtlases)
@@ -4471,6 +5283,9 @@ void ImGui::Shutdown()
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    for (ImVector<ImGuiWindow*>& cell : g.WindowsHitGrid.Cells)
+        cell.clear();
+    g.WindowsHitGrid.WindowsCount = 0;
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4512,6 +5327,7 @@ void ImGui::Shutdown()
     g.SettingsWindows.clear();
     g.SettingsHandlers.clear();
 
+    LogFlushBatch();
     if (g.LogFile)
     {
 #ifndef IMGUI_DISABLE_TTY_FUNCTIONS
@@ -4589,6 +5405,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NUL
     FontRefSize = 0.0f;
     FontWindowScale = FontWindowScaleParents = 1.0f;
     SettingsOffset = -1;
+    HitGridCellMin = HitGridCellMax = ImVec2ih(-1, -1);
     DrawList = &DrawListInst;
     DrawList->_OwnerName = Name;
     DrawList->_SetDrawListSharedData(&Ctx->DrawListSharedData);
@@ -4641,14 +5458,19 @@ void ImGui::GcCompactTransientMiscBuffers()
 // Not freed:
 // - ImGuiWindow, ImGuiWindowSettings, Name, StateStorage, ColumnsStorage (may hold useful data)
 // This should have no noticeable visual effect. When the window reappear however, expect new allocation/buffer growth/copy cost.
+// - io.ConfigMemoryCompactDrawLists = false keeps ImDrawList buffers, which are the most costly to grow back.
 // FIXME: Consider exposing of elaborating GC policy, e.g. being able to trim excessive ImDrawList gaps. (#9303)
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
+    ImGuiContext& g = *GImGui;
     window->MemoryCompacted = true;
-    window->MemoryDrawListIdxCapacity = ImMin((int)(window->DrawList->IdxBuffer.Size * 1.05f), window->DrawList->IdxBuffer.Capacity);
-    window->MemoryDrawListVtxCapacity = ImMin((int)(window->DrawList->VtxBuffer.Size * 1.05f), window->DrawList->VtxBuffer.Capacity);
     window->IDStack.clear();
-    window->DrawList->_ClearFreeMemory();
+    if (g.IO.ConfigMemoryCompactDrawLists)
+    {
+        window->MemoryDrawListIdxCapacity = ImMin((int)(window->DrawList->IdxBuffer.Size * 1.05f), window->DrawList->IdxBuffer.Capacity);
+        window->MemoryDrawListVtxCapacity = ImMin((int)(window->DrawList->VtxBuffer.Size * 1.05f), window->DrawList->VtxBuffer.Capacity);
+        window->DrawList->_ClearFreeMemory();
+    }
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
@@ -5081,7 +5903,11 @@ void* ImGui::MemAlloc(size_t size)
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
+    {
         DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (ctx->DebugAllocInfo.SteadyState)
+            DebugAllocReportSteadyState(ctx, size, IM_RETURN_ADDRESS());
+    }
 #endif
     return ptr;
 }
@@ -5130,6 +5956,39 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
     }
 }
 
+// Called by MemAlloc() when allocating during a frame preceded by io.ConfigDebugAllocSteadyStateFrames allocation-free frames.
+void ImGui::DebugAllocReportSteadyState(ImGuiContext* ctx, size_t size, void* return_address)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
+    info->SteadyState = false; // Restart tracking. Also prevents reentrancy as logging below may allocate.
+    info->SteadyStateFrames = 0;
+
+    ImGuiDebugAllocCallSite* site = &info->SteadyStateAllocsBuf[info->SteadyStateAllocsCount % IM_COUNTOF(info->SteadyStateAllocsBuf)];
+    info->SteadyStateAllocsCount++;
+    site->FrameCount = g.FrameCount;
+    site->Size = size;
+    site->WindowID = g.CurrentWindow ? g.CurrentWindow->ID : 0;
+    site->ItemID = g.CurrentWindow ? g.LastItemData.ID : 0;
+    site->ReturnAddress = return_address;
+    IMGUI_DEBUG_LOG_ERROR("[memory] MemAlloc(%d) in steady-state frame %d, window '%s', last item 0x%08X, return address %p\n",
+        (int)size, g.FrameCount, g.CurrentWindow ? g.CurrentWindow->Name : "<NULL>", site->ItemID, return_address);
+    if (g.IO.ConfigDebugAllocSteadyStateAssert)
+        IM_ASSERT(0 && "Allocation in a steady-state frame! Inspect the call-stack to find the call site.");
+}
+
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+// Update steady-state tracking once per frame (a frame without allocations since the previous NewFrame() call).
+static void DebugAllocUpdateSteadyState(ImGuiContext& g)
+{
+    ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
+    const ImGuiDebugAllocEntry* entry = &info->LastEntriesBuf[info->LastEntriesIdx];
+    const bool prev_frame_allocated = (entry->FrameCount == g.FrameCount - 1 && entry->AllocCount > 0);
+    info->SteadyStateFrames = prev_frame_allocated ? 0 : info->SteadyStateFrames + 1;
+    info->SteadyState = (g.IO.ConfigDebugAllocSteadyStateFrames > 0 && info->SteadyStateFrames >= g.IO.ConfigDebugAllocSteadyStateFrames);
+}
+#endif
+
 // A conformant backend should return NULL on failure (e.g. clipboard data is not text).
 const char* ImGui::GetClipboardText()
 {
@@ -5391,6 +6250,7 @@ static bool IsWindowActiveAndVisible(ImGuiWindow* window)
 void ImGui::UpdateHoveredWindowAndCaptureFlags(const ImVec2& mouse_pos)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateHoveredWindow");
     ImGuiIO& io = g.IO;
 
     // FIXME-DPI: This storage was added on 2021/03/31 for test engine, but if we want to multiply WINDOWS_HOVER_PADDING
@@ -5499,6 +6359,10 @@ void ImGui::NewFrame()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerNewFrame(&g);
+#endif
+    IMGUI_PROFILER_ZONE("NewFrame");
 
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
@@ -5516,6 +6380,9 @@ void ImGui::NewFrame()
 
     g.Time += g.IO.DeltaTime;
     g.FrameCount += 1;
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    DebugAllocUpdateSteadyState(g);
+#endif
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -5533,6 +6400,7 @@ void ImGui::NewFrame()
 
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
+    UpdateWindowsHitGridNewFrame();
 
     // Update texture list (collect destroyed textures, etc.)
     UpdateTexturesNewFrame();
@@ -5684,6 +6552,8 @@ void ImGui::NewFrame()
         window->WriteAccessed = false;
         window->BeginCountPreviousFrame = window->BeginCount;
         window->BeginCount = 0;
+        if (!window->WasActive && window->HitGridCellMin.x != -1)
+            RemoveWindowFromHitGrid(window);
 
         // Garbage collect transient buffers of recently unused windows
         if ((!window->WasActive || gc_all) && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
@@ -5794,6 +6664,7 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
 
 static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
 {
+    window->DisplayIndex = out_sorted_windows->Size;
     out_sorted_windows->push_back(window);
     if (window->Active)
     {
@@ -5978,6 +6849,7 @@ static void ImGui::RenderDimmedBackgrounds()
 void ImGui::EndFrame()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("EndFrame");
     IM_ASSERT(g.Initialized);
 
     // Don't process EndFrame() multiple times.
@@ -5987,6 +6859,10 @@ void ImGui::EndFrame()
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
 
+    // Write text captured this frame when logging to file/callback
+    if (g.LogEnabled)
+        LogFlushBatch();
+
     // [EXPERIMENTAL] Recover from errors
     if (g.IO.ConfigErrorRecovery)
         ErrorRecoveryTryToRecoverState(&g.StackSizesInNewFrame);
@@ -6083,6 +6959,7 @@ void ImGui::EndFrame()
 void ImGui::Render()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("Render");
     IM_ASSERT(g.Initialized);
 
     if (g.FrameCountEnded != g.FrameCount)
@@ -6180,6 +7057,115 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
+//-----------------------------------------------------------------------------
+// Window Hit Grid
+//-----------------------------------------------------------------------------
+// Coarse uniform grid over the main viewport, listing active windows overlapping each cell.
+// Allows FindHoveredWindowEx() to only test a handful of windows instead of walking the whole g.Windows[] list,
+// which matters when using thousands of windows (e.g. many child windows or node editors).
+//-----------------------------------------------------------------------------
+
+static void ImGui::UpdateWindowsHitGridNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+    ImGuiViewportP* viewport = g.Viewports[0];
+    const ImRect bounds = viewport->GetMainRect();
+    const float padding = ImMax(ImMax(g.Style.TouchExtraPadding.x, g.Style.TouchExtraPadding.y), g.Style.WindowBorderHoverPadding);
+    if (grid->Bounds.Min == bounds.Min && grid->Bounds.Max == bounds.Max && grid->Padding == padding)
+        return;
+
+    // Rebuild from last frame rectangles, as hovering is evaluated before windows are submitted again.
+    for (ImVector<ImGuiWindow*>& cell : grid->Cells)
+        cell.resize(0);
+    grid->WindowsCount = 0;
+    grid->Bounds = bounds;
+    grid->CellSize = ImVec2(bounds.GetWidth() / IMGUI_WINDOW_HIT_GRID_CELLS, bounds.GetHeight() / IMGUI_WINDOW_HIT_GRID_CELLS);
+    grid->Padding = padding;
+    for (ImGuiWindow* window : g.Windows)
+    {
+        window->HitGridCellMin = window->HitGridCellMax = ImVec2ih(-1, -1);
+        if (window->WasActive || window->Active)
+            UpdateWindowInHitGrid(window);
+    }
+}
+
+static void ImGui::UpdateWindowInHitGrid(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+
+    // Calculate range of cells covered (empty when fully outside of the grid)
+    ImVec2ih cell_min(-1, -1), cell_max(-1, -1);
+    ImRect r = window->OuterRectClipped;
+    r.Expand(grid->Padding);
+    r.ClipWith(grid->Bounds);
+    if (r.Min.x < r.Max.x && r.Min.y < r.Max.y && grid->CellSize.x > 0.0f && grid->CellSize.y > 0.0f)
+    {
+        const int cell_last = IMGUI_WINDOW_HIT_GRID_CELLS - 1;
+        cell_min.x = (short)ImClamp((int)((r.Min.x - grid->Bounds.Min.x) / grid->CellSize.x), 0, cell_last);
+        cell_min.y = (short)ImClamp((int)((r.Min.y - grid->Bounds.Min.y) / grid->CellSize.y), 0, cell_last);
+        cell_max.x = (short)ImClamp((int)((r.Max.x - grid->Bounds.Min.x) / grid->CellSize.x), 0, cell_last);
+        cell_max.y = (short)ImClamp((int)((r.Max.y - grid->Bounds.Min.y) / grid->CellSize.y), 0, cell_last);
+    }
+    if (cell_min.x == window->HitGridCellMin.x && cell_min.y == window->HitGridCellMin.y && cell_max.x == window->HitGridCellMax.x && cell_max.y == window->HitGridCellMax.y)
+        return;
+
+    if (window->HitGridCellMin.x != -1)
+        RemoveWindowFromHitGrid(window);
+    if (cell_min.x == -1)
+        return;
+    for (int cell_y = cell_min.y; cell_y <= cell_max.y; cell_y++)
+        for (int cell_x = cell_min.x; cell_x <= cell_max.x; cell_x++)
+            grid->Cells[cell_y * IMGUI_WINDOW_HIT_GRID_CELLS + cell_x].push_back(window);
+    window->HitGridCellMin = cell_min;
+    window->HitGridCellMax = cell_max;
+    grid->WindowsCount++;
+}
+
+static void ImGui::RemoveWindowFromHitGrid(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+    IM_ASSERT(window->HitGridCellMin.x != -1);
+    for (int cell_y = window->HitGridCellMin.y; cell_y <= window->HitGridCellMax.y; cell_y++)
+        for (int cell_x = window->HitGridCellMin.x; cell_x <= window->HitGridCellMax.x; cell_x++)
+        {
+            ImVector<ImGuiWindow*>& cell = grid->Cells[cell_y * IMGUI_WINDOW_HIT_GRID_CELLS + cell_x];
+            ImGuiWindow** it = cell.find(window);
+            IM_ASSERT(it != cell.end());
+            *it = cell.back(); // Cells are unordered
+            cell.pop_back();
+        }
+    window->HitGridCellMin = window->HitGridCellMax = ImVec2ih(-1, -1);
+    grid->WindowsCount--;
+}
+
+// Hit-test a single window, shared by linear and grid search in FindHoveredWindowEx()
+static bool IsWindowHitByPos(ImGuiWindow* window, const ImVec2& pos, const ImVec2& padding_regular, const ImVec2& padding_for_resize)
+{
+    if (!window->WasActive || window->Hidden)
+        return false;
+    if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+        return false;
+
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
+    if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
+        return false;
+
+    // Support for one rectangular hole in any given window
+    // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
+    if (window->HitTestHoleSize.x != 0)
+    {
+        ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+        ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+        if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
+            return false;
+    }
+    return true;
+}
+
 // Find window given position, search front-to-back
 // - Typically write output back to g.HoveredWindow and g.HoveredWindowUnderMovingWindow.
 // - FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
@@ -6197,44 +7183,62 @@ void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_vi
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
-    {
-        ImGuiWindow* window = g.Windows[i];
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->WasActive || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
-
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
-        if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
-            continue;
-
-        // Support for one rectangular hole in any given window
-        // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+    if (grid->Bounds.Contains(pos) && grid->CellSize.x > 0.0f && grid->CellSize.y > 0.0f)
+    {
+        // Fast path: only test windows overlapping the cell. As cells are unordered, keep the front-most hits.
+        const int cell_x = ImMin((int)((pos.x - grid->Bounds.Min.x) / grid->CellSize.x), IMGUI_WINDOW_HIT_GRID_CELLS - 1);
+        const int cell_y = ImMin((int)((pos.y - grid->Bounds.Min.y) / grid->CellSize.y), IMGUI_WINDOW_HIT_GRID_CELLS - 1);
+        int best_display_index = -1;
+        int best_display_index_under_moving_window = -1;
+        ImGuiWindow* best_window = NULL;
+        ImGuiWindow* best_window_under_moving_window = NULL;
+        for (ImGuiWindow* window : grid->Cells[cell_y * IMGUI_WINDOW_HIT_GRID_CELLS + cell_x])
         {
-            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
-            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
-            if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
+            if (!IsWindowHitByPos(window, pos, padding_regular, padding_for_resize))
                 continue;
+            const int display_index = FindWindowDisplayIndex(window);
+            if (display_index > best_display_index)
+            {
+                best_display_index = display_index;
+                best_window = window;
+            }
+            if (display_index > best_display_index_under_moving_window && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
+            {
+                best_display_index_under_moving_window = display_index;
+                best_window_under_moving_window = window;
+            }
         }
-
-        if (find_first_and_in_any_viewport)
-        {
-            hovered_window = window;
-            break;
-        }
-        else
+        if (find_first_and_in_any_viewport || hovered_window == NULL)
+            hovered_window = best_window;
+        if (!find_first_and_in_any_viewport)
+            hovered_window_under_moving_window = best_window_under_moving_window;
+    }
+    else
+    {
+        // Slow path: linear search (position outside of main viewport)
+        for (int i = g.Windows.Size - 1; i >= 0; i--)
         {
-            if (hovered_window == NULL)
-                hovered_window = window;
+            ImGuiWindow* window = g.Windows[i];
             IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-            if (hovered_window_under_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
-                hovered_window_under_moving_window = window;
-            if (hovered_window && hovered_window_under_moving_window)
+            if (!IsWindowHitByPos(window, pos, padding_regular, padding_for_resize))
+                continue;
+
+            if (find_first_and_in_any_viewport)
+            {
+                hovered_window = window;
                 break;
+            }
+            else
+            {
+                if (hovered_window == NULL)
+                    hovered_window = window;
+                IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+                if (hovered_window_under_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
+                    hovered_window_under_moving_window = window;
+                if (hovered_window && hovered_window_under_moving_window)
+                    break;
+            }
         }
     }
 
@@ -7415,6 +8419,7 @@ static void SetWindowActiveForSkipRefresh(ImGuiWindow* window)
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("Begin");
     const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
@@ -7909,6 +8914,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         const ImRect title_bar_rect = window->TitleBarRect();
         window->OuterRectClipped = outer_rect;
         window->OuterRectClipped.ClipWith(host_rect);
+        UpdateWindowInHitGrid(window);
 
         // Inner rectangle
         // Not affected by window border size. Used by:
@@ -8218,6 +9224,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 void ImGui::End()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("End");
     ImGuiWindow* window = g.CurrentWindow;
 
     // Error checking: verify that user hasn't called End() too many times!
@@ -10467,6 +11474,7 @@ static void DebugPrintInputEvent(const char* prefix, const ImGuiInputEvent* e)
 void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("UpdateInputEvents");
     ImGuiIO& io = g.IO;
 
     // Only trickle chars<>key when working with InputText()
@@ -12914,13 +13922,11 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
     ImGuiWindow* current_front_window = g.Windows.back();
     if (current_front_window == window || current_front_window->RootWindow == window) // Cheap early out (could be better)
         return;
-    for (int i = g.Windows.Size - 2; i >= 0; i--) // We can ignore the top-most window
-        if (g.Windows[i] == window)
-        {
-            memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
-            g.Windows[g.Windows.Size - 1] = window;
-            break;
-        }
+    const int i = FindWindowDisplayIndex(window);
+    memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
+    g.Windows[g.Windows.Size - 1] = window;
+    for (int n = i; n < g.Windows.Size; n++)
+        g.Windows[n]->DisplayIndex = n;
 }
 
 void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
@@ -12928,13 +13934,11 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
     ImGuiContext& g = *GImGui;
     if (g.Windows[0] == window)
         return;
-    for (int i = 0; i < g.Windows.Size; i++)
-        if (g.Windows[i] == window)
-        {
-            memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
-            g.Windows[0] = window;
-            break;
-        }
+    const int i = FindWindowDisplayIndex(window);
+    memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
+    g.Windows[0] = window;
+    for (int n = 0; n <= i; n++)
+        g.Windows[n]->DisplayIndex = n;
 }
 
 void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_window)
@@ -12950,19 +13954,34 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
         size_t copy_bytes = (pos_beh - pos_wnd - 1) * sizeof(ImGuiWindow*);
         memmove(&g.Windows.Data[pos_wnd], &g.Windows.Data[pos_wnd + 1], copy_bytes);
         g.Windows[pos_beh - 1] = window;
+        for (int n = pos_wnd; n < pos_beh; n++)
+            g.Windows[n]->DisplayIndex = n;
     }
     else
     {
         size_t copy_bytes = (pos_wnd - pos_beh) * sizeof(ImGuiWindow*);
         memmove(&g.Windows.Data[pos_beh + 1], &g.Windows.Data[pos_beh], copy_bytes);
         g.Windows[pos_beh] = window;
+        for (int n = pos_beh; n <= pos_wnd; n++)
+            g.Windows[n]->DisplayIndex = n;
     }
 }
 
+// Return index of window in g.Windows[] (display order, back to front).
+// ImGuiWindow::DisplayIndex is maintained by EndFrame() sorting and BringWindowToDisplayXXX() functions.
+// Other mutations of g.Windows[] (e.g. creating a window) leave it stale, in which case we renumber all windows.
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
-    return g.Windows.index_from_ptr(g.Windows.find(window));
+    int idx = window->DisplayIndex;
+    if (idx < 0 || idx >= g.Windows.Size || g.Windows.Data[idx] != window)
+    {
+        for (int n = 0; n < g.Windows.Size; n++)
+            g.Windows.Data[n]->DisplayIndex = n;
+        idx = window->DisplayIndex;
+        IM_ASSERT(idx >= 0 && idx < g.Windows.Size && g.Windows.Data[idx] == window);
+    }
+    return idx;
 }
 
 // Moving window to front of display and set focus (which happens to be back of our sorted list)
@@ -13321,6 +14340,33 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result, const ImRect& nav_bb)
     return new_best;
 }
 
+// Cheap conservative test to skip scoring items which cannot become the best candidate of current move request.
+// - Items which are behind the scoring rectangle can never be in the requested quadrant.
+// - For vertical moves, items further than current best candidate along the move axis can never beat it (dist_box >= abs(dby)).
+// This doesn't reorganize anything: items are still submitted and processed in order, we only avoid the full NavScoreItem() cost
+// for the vast majority of items when navigating in windows with tens of thousands of items. Must only reject items that NavScoreItem() would reject.
+static bool NavScoreItemIsOutOfReach(const ImGuiNavItemData* result, const ImRect& cand)
+{
+#if IMGUI_DEBUG_NAV_SCORING
+    IM_UNUSED(result);
+    IM_UNUSED(cand);
+    return false;
+#else
+    ImGuiContext& g = *GImGui;
+    if (g.NavLayer == ImGuiNavLayer_Menu) // Axial check in NavScoreItem() may accept items outside of quadrant
+        return false;
+    const ImRect& curr = g.NavScoringRect;
+    switch (g.NavMoveDir)
+    {
+    case ImGuiDir_Left:  return cand.Min.x >= curr.Max.x;
+    case ImGuiDir_Right: return cand.Max.x <= curr.Min.x;
+    case ImGuiDir_Up:    return cand.Min.y >= curr.Max.y || ImLerp(curr.Min.y, curr.Max.y, 0.2f) - cand.Max.y > result->DistBox;
+    case ImGuiDir_Down:  return cand.Max.y <= curr.Min.y || cand.Min.y - ImLerp(curr.Min.y, curr.Max.y, 0.8f) > result->DistBox;
+    default:             return false;
+    }
+#endif
+}
+
 static void ImGui::NavApplyItemToResult(ImGuiNavItemData* result)
 {
     ImGuiContext& g = *GImGui;
@@ -13393,7 +14439,7 @@ static void ImGui::NavProcessItem()
             else if (g.NavId != id || (g.NavMoveFlags & ImGuiNavMoveFlags_AllowCurrentNavId))
             {
                 ImGuiNavItemData* result = (window == g.NavWindow) ? &g.NavMoveResultLocal : &g.NavMoveResultOther;
-                if (NavScoreItem(result, nav_bb))
+                if (!NavScoreItemIsOutOfReach(result, nav_bb) && NavScoreItem(result, nav_bb))
                     NavApplyItemToResult(result);
 
                 // Features like PageUp/PageDown need to maintain a separate score for the visible set of items.
@@ -13403,7 +14449,7 @@ static void ImGui::NavProcessItem()
                     const ImRect& r = window->InnerRect; // window->ClipRect
                     if (r.Overlaps(nav_bb))
                         if (ImClamp(nav_bb.Max.y, r.Min.y, r.Max.y) - ImClamp(nav_bb.Min.y, r.Min.y, r.Max.y) >= (nav_bb.Max.y - nav_bb.Min.y) * VISIBLE_RATIO)
-                            if (NavScoreItem(&g.NavMoveResultLocalVisible, nav_bb))
+                            if (!NavScoreItemIsOutOfReach(&g.NavMoveResultLocalVisible, nav_bb) && NavScoreItem(&g.NavMoveResultLocalVisible, nav_bb))
                                 NavApplyItemToResult(&g.NavMoveResultLocalVisible);
                 }
             }
@@ -13743,6 +14789,7 @@ float ImGui::GetNavTweakPressedAmount(ImGuiAxis axis)
 static void ImGui::NavUpdate()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("NavUpdate");
     ImGuiIO& io = g.IO;
 
     io.WantSetMousePos = false;
@@ -15185,12 +16232,40 @@ void ImGui::EndDragDropTarget()
 //-----------------------------------------------------------------------------
 // All text output from the interface can be captured into tty/file/clipboard.
 // By default, tree nodes are automatically opened during logging.
+// When logging to a file or callback, text is accumulated in batches which are written at the end of each frame,
+// when reaching IMGUI_LOG_BATCH_SIZE, and in LogFinish(). This reduces the cost of capturing large amounts of text (e.g. a table dump).
+// - LogToCallback(): your callback is called from the thread calling Dear ImGui functions. To never block a frame on slow writes,
+//   copy the batch into your own queue and write it (and e.g. compress it) from another thread.
+//   The callback is called with text == NULL and text_len == 0 by LogFinish(), to signal the end of a capture.
 //-----------------------------------------------------------------------------
 
+#ifndef IMGUI_LOG_BATCH_SIZE
+#define IMGUI_LOG_BATCH_SIZE    (64 * 1024)
+#endif
+
+// Write accumulated text batch to file/callback
+void ImGui::LogFlushBatch()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.LogBuffer.empty() || (g.LogFlags & (ImGuiLogFlags_OutputFile | ImGuiLogFlags_OutputCallback)) == 0)
+        return;
+    if (g.LogFlags & ImGuiLogFlags_OutputFile)
+        ImFileWrite(g.LogBuffer.c_str(), sizeof(char), (ImU64)g.LogBuffer.size(), g.LogFile);
+    else
+        g.LogCallback(g.LogCallbackUserData, g.LogBuffer.c_str(), g.LogBuffer.size());
+    g.LogBuffer.Buf.resize(0);
+}
+
+static inline void LogTextAppended(ImGuiContext& g)
+{
+    if ((g.LogFlags & (ImGuiLogFlags_OutputFile | ImGuiLogFlags_OutputCallback)) && g.LogBuffer.size() >= IMGUI_LOG_BATCH_SIZE)
+        ImGui::LogFlushBatch();
+}
+
 // Pass text data straight to log (without being displayed)
 static inline void LogTextV(ImGuiContext& g, const char* fmt, va_list args)
 {
-    if (g.LogFile)
+    if (g.LogFlags & ImGuiLogFlags_OutputTTY)
     {
         g.LogBuffer.Buf.resize(0);
         g.LogBuffer.appendfv(fmt, args);
@@ -15199,9 +16274,25 @@ static inline void LogTextV(ImGuiContext& g, const char* fmt, va_list args)
     else
     {
         g.LogBuffer.appendfv(fmt, args);
+        LogTextAppended(g);
     }
 }
 
+// Same as LogTextV() without formatting, optionally prefixed by 'indent' spaces
+static void LogTextUnformatted(ImGuiContext& g, int indent, const char* text, const char* text_end)
+{
+    static const char spaces[] = "                                                                "; // 64
+    if (g.LogFlags & ImGuiLogFlags_OutputTTY)
+        g.LogBuffer.Buf.resize(0);
+    for (int n = indent; n > 0; n -= IM_COUNTOF(spaces) - 1)
+        g.LogBuffer.append(spaces, spaces + ImMin(n, IM_COUNTOF(spaces) - 1));
+    g.LogBuffer.append(text, text_end);
+    if (g.LogFlags & ImGuiLogFlags_OutputTTY)
+        ImFileWrite(g.LogBuffer.c_str(), sizeof(char), (ImU64)g.LogBuffer.size(), g.LogFile);
+    else
+        LogTextAppended(g);
+}
+
 void ImGui::LogText(const char* fmt, ...)
 {
     ImGuiContext& g = *GImGui;
@@ -15243,7 +16334,7 @@ void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char*
         g.LogLinePosY = ref_pos->y;
     if (log_new_line)
     {
-        LogText(IM_NEWLINE);
+        LogTextUnformatted(g, 0, IM_NEWLINE, NULL);
         g.LogLineFirstItem = true;
     }
 
@@ -15265,13 +16356,12 @@ void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char*
         const bool is_last_line = (line_end == text_end);
         if (line_start != line_end || !is_last_line)
         {
-            const int line_length = (int)(line_end - line_start);
             const int indentation = g.LogLineFirstItem ? tree_depth * 4 : 1;
-            LogText("%*s%.*s", indentation, "", line_length, line_start);
+            LogTextUnformatted(g, indentation, line_start, line_end);
             g.LogLineFirstItem = false;
             if (*line_end == '\n')
             {
-                LogText(IM_NEWLINE);
+                LogTextUnformatted(g, 0, IM_NEWLINE, NULL);
                 g.LogLineFirstItem = true;
             }
         }
@@ -15365,6 +16455,18 @@ void ImGui::LogToBuffer(int auto_open_depth)
     LogBegin(ImGuiLogFlags_OutputBuffer, auto_open_depth);
 }
 
+// Start logging/capturing text output to your callback
+void ImGui::LogToCallback(ImGuiLogCallback callback, void* user_data, int auto_open_depth)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.LogEnabled)
+        return;
+    IM_ASSERT(callback != NULL);
+    LogBegin(ImGuiLogFlags_OutputCallback, auto_open_depth);
+    g.LogCallback = callback;
+    g.LogCallbackUserData = user_data;
+}
+
 void ImGui::LogFinish()
 {
     ImGuiContext& g = *GImGui;
@@ -15380,8 +16482,13 @@ void ImGui::LogFinish()
 #endif
         break;
     case ImGuiLogFlags_OutputFile:
+        LogFlushBatch();
         ImFileClose(g.LogFile);
         break;
+    case ImGuiLogFlags_OutputCallback:
+        LogFlushBatch();
+        g.LogCallback(g.LogCallbackUserData, NULL, 0);
+        break;
     case ImGuiLogFlags_OutputBuffer:
         break;
     case ImGuiLogFlags_OutputClipboard:
@@ -15394,9 +16501,14 @@ void ImGui::LogFinish()
     }
 
     g.LogEnabled = g.ItemUnclipByLog = false;
+    if (g.LogFlags & (ImGuiLogFlags_OutputFile | ImGuiLogFlags_OutputCallback))
+        g.LogBuffer.Buf.resize(0); // Keep batch buffer allocated: its size is bounded by IMGUI_LOG_BATCH_SIZE
+    else
+        g.LogBuffer.clear();
     g.LogFlags = ImGuiLogFlags_None;
     g.LogFile = NULL;
-    g.LogBuffer.clear();
+    g.LogCallback = NULL;
+    g.LogCallbackUserData = NULL;
 }
 
 // Helper to display logging buttons
@@ -16125,6 +17237,170 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 
 #endif // Default IME handlers
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerGetTime()
+// - ImGuiProfilerScope
+// - ProfilerNewFrame() [Internal]
+// - ProfilerZoneBegin() [Internal]
+// - ProfilerZoneEnd() [Internal]
+// - ProfilerSetHooks()
+// - ProfilerFindZoneStats()
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+// Default high resolution clock (override with platform_io.Platform_GetTimeNsFn)
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+static ImU64 Platform_GetTimeNsFn_DefaultImpl(ImGuiContext*)
+{
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    const ImU64 ticks = (ImU64)counter.QuadPart, ticks_per_second = (ImU64)frequency.QuadPart;
+    return (ticks / ticks_per_second) * 1000000000 + (ticks % ticks_per_second) * 1000000000 / ticks_per_second; // Avoid overflow
+}
+#elif defined(__unix__) || defined(__APPLE__)
+#include <time.h>       // clock_gettime()
+static ImU64 Platform_GetTimeNsFn_DefaultImpl(ImGuiContext*)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+}
+#else
+static ImU64 Platform_GetTimeNsFn_DefaultImpl(ImGuiContext* ctx)
+{
+    return (ImU64)(ctx->Time * 1000000000.0); // No high resolution clock: zones will mostly measure 0 unless you provide one
+}
+#endif
+
+ImU64 ImGui::ProfilerGetTime()
+{
+    ImGuiContext& g = *GImGui;
+    return g.PlatformIO.Platform_GetTimeNsFn ? g.PlatformIO.Platform_GetTimeNsFn(&g) : 0;
+}
+
+ImGuiProfilerScope::ImGuiProfilerScope(const char* name)
+{
+    Ctx = GImGui;
+    Name = name;
+    RecordIdx = ZoneIdx = -1;
+    TimeBegin = 0;
+    if (Ctx != NULL) // ImFont::RenderText() may be called without a context
+        ImGui::ProfilerZoneBegin(this);
+}
+
+ImGuiProfilerScope::~ImGuiProfilerScope()
+{
+    if (Ctx != NULL)
+        ImGui::ProfilerZoneEnd(this);
+}
+
+// Called at the beginning of NewFrame(): move aggregated timings of the previous frame into the 'LastFrame' fields.
+void ImGui::ProfilerNewFrame(ImGuiContext* ctx)
+{
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    if (profiler->Paused)
+        return;
+    for (ImGuiProfilerZoneStats& zone : profiler->Zones)
+    {
+        const float time_ms = (float)((double)zone.TimeThisFrame / 1000000.0);
+        zone.CallsLastFrame = zone.CallsThisFrame;
+        zone.TimeLastFrame = zone.TimeThisFrame;
+        zone.TimeAvgMs = (zone.TimeAvgMs == 0.0f) ? time_ms : zone.TimeAvgMs + (time_ms - zone.TimeAvgMs) * 0.05f;
+        zone.TimeMaxMs = ImMax(zone.TimeMaxMs, time_ms);
+        zone.CallsThisFrame = 0;
+        zone.TimeThisFrame = 0;
+    }
+}
+
+void ImGui::ProfilerZoneBegin(ImGuiProfilerScope* scope)
+{
+    ImGuiContext* ctx = scope->Ctx;
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    if (profiler->HookZoneBegin != NULL)
+        profiler->HookZoneBegin(ctx, scope->Name, profiler->HookUserData);
+    const int depth = profiler->Depth++;
+    scope->TimeBegin = ProfilerGetTime();
+    if (profiler->Paused || profiler->Records.Size == 0)
+        return;
+
+    // Record zone in ring buffer
+    scope->RecordIdx = profiler->RecordsNext;
+    profiler->RecordsNext = (profiler->RecordsNext + 1) % profiler->Records.Size;
+    if (profiler->RecordsCount < profiler->Records.Size)
+        profiler->RecordsCount++;
+    ImGuiProfilerRecord* rec = &profiler->Records[scope->RecordIdx];
+    rec->Name = scope->Name;
+    rec->TimeBegin = scope->TimeBegin;
+    rec->TimeEnd = 0;
+    rec->FrameCount = ctx->FrameCount;
+    rec->Depth = depth;
+
+    // Find aggregated stats (zone names are expected to be persistent strings, so we compare pointers first)
+    for (int n = 0; n < profiler->Zones.Size && scope->ZoneIdx == -1; n++)
+        if (profiler->Zones[n].Name == scope->Name)
+            scope->ZoneIdx = n;
+    for (int n = 0; n < profiler->Zones.Size && scope->ZoneIdx == -1; n++)
+        if (strcmp(profiler->Zones[n].Name, scope->Name) == 0)
+            scope->ZoneIdx = n;
+    if (scope->ZoneIdx == -1)
+    {
+        scope->ZoneIdx = profiler->Zones.Size;
+        profiler->Zones.push_back(ImGuiProfilerZoneStats());
+        profiler->Zones.back().Name = scope->Name;
+    }
+    profiler->Zones[scope->ZoneIdx].NestingDepth++;
+}
+
+void ImGui::ProfilerZoneEnd(ImGuiProfilerScope* scope)
+{
+    ImGuiContext* ctx = scope->Ctx;
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    const ImU64 time_end = ProfilerGetTime();
+    profiler->Depth--;
+    if (scope->RecordIdx != -1)
+    {
+        // Record may have been overwritten if more than IMGUI_PROFILER_RECORDS_CAPACITY zones were recorded in between
+        ImGuiProfilerRecord* rec = &profiler->Records[scope->RecordIdx];
+        if (rec->Name == scope->Name && rec->TimeBegin == scope->TimeBegin)
+            rec->TimeEnd = time_end;
+
+        // Nested instances of a same zone are accounted for once, by the outer instance
+        ImGuiProfilerZoneStats* zone = &profiler->Zones[scope->ZoneIdx];
+        zone->CallsThisFrame++;
+        if (--zone->NestingDepth == 0)
+            zone->TimeThisFrame += time_end - scope->TimeBegin;
+    }
+    if (profiler->HookZoneEnd != NULL)
+        profiler->HookZoneEnd(ctx, scope->Name, profiler->HookUserData);
+}
+
+// Forward zones to an external profiler, e.g. hooks calling ___tracy_emit_zone_begin()/___tracy_emit_zone_end().
+// Hooks are called even while g.Profiler.Paused is set.
+void ImGui::ProfilerSetHooks(ImGuiProfilerZoneHookFn zone_begin, ImGuiProfilerZoneHookFn zone_end, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    g.Profiler.HookZoneBegin = zone_begin;
+    g.Profiler.HookZoneEnd = zone_end;
+    g.Profiler.HookUserData = user_data;
+}
+
+const ImGuiProfilerZoneStats* ImGui::ProfilerFindZoneStats(const char* name)
+{
+    ImGuiContext& g = *GImGui;
+    for (const ImGuiProfilerZoneStats& zone : g.Profiler.Zones)
+        if (strcmp(zone.Name, name) == 0)
+            return &zone;
+    return NULL;
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -16935,9 +18211,30 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 Text("<- %d frames ago", g.FrameCount - entry->FrameCount);
             }
         }
+        if (g.IO.ConfigDebugAllocSteadyStateFrames > 0)
+        {
+            Text("Steady-state: %s (%d allocation-free frames, threshold %d)", info->SteadyState ? "Yes" : "No", info->SteadyStateFrames, g.IO.ConfigDebugAllocSteadyStateFrames);
+            Checkbox("Assert on allocation in steady-state frame", &g.IO.ConfigDebugAllocSteadyStateAssert);
+            Text("Allocations in steady-state frames: %d", info->SteadyStateAllocsCount);
+            const int sites_count = ImMin(info->SteadyStateAllocsCount, (int)IM_COUNTOF(info->SteadyStateAllocsBuf));
+            for (int n = 0; n < sites_count; n++)
+            {
+                ImGuiDebugAllocCallSite* site = &info->SteadyStateAllocsBuf[(info->SteadyStateAllocsCount - 1 - n) % IM_COUNTOF(info->SteadyStateAllocsBuf)];
+                ImGuiWindow* site_window = FindWindowByID(site->WindowID);
+                BulletText("Frame %06d: %d bytes, window '%s', last item 0x%08X, return address %p", site->FrameCount, (int)site->Size, site_window ? site_window->Name : "<NULL>", site->ItemID, site->ReturnAddress);
+            }
+        }
+        else
+        {
+            TextDisabled("Set io.ConfigDebugAllocSteadyStateFrames to audit allocations in steady-state frames.");
+        }
         TreePop();
     }
 
+#ifdef IMGUI_ENABLE_PROFILER
+    DebugNodeProfiler(&g.Profiler);
+#endif
+
     if (TreeNode("Inputs"))
     {
         Text("KEYBOARD/GAMEPAD/MOUSE KEYS");
@@ -17580,6 +18877,59 @@ void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
     TreePop();
 }
 
+#ifdef IMGUI_ENABLE_PROFILER
+// [DEBUG] Display aggregated zones timings and zones recorded in last frame
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    ImGuiContext& g = *GImGui;
+    if (!TreeNode("Profiler", "Profiler (%d zones, %d records)", profiler->Zones.Size, profiler->RecordsCount))
+        return;
+    Checkbox("Paused", &profiler->Paused);
+    SameLine();
+    if (SmallButton("Reset max"))
+        for (ImGuiProfilerZoneStats& zone : profiler->Zones)
+            zone.TimeMaxMs = 0.0f;
+    if (BeginTable("##zones", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+    {
+        TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Calls");
+        TableSetupColumn("Last (ms)");
+        TableSetupColumn("Avg (ms)");
+        TableSetupColumn("Max (ms)");
+        TableHeadersRow();
+        for (const ImGuiProfilerZoneStats& zone : profiler->Zones)
+        {
+            TableNextRow();
+            TableNextColumn(); TextUnformatted(zone.Name);
+            TableNextColumn(); Text("%d", zone.CallsLastFrame);
+            TableNextColumn(); Text("%.3f", (double)zone.TimeLastFrame / 1000000.0);
+            TableNextColumn(); Text("%.3f", zone.TimeAvgMs);
+            TableNextColumn(); Text("%.3f", zone.TimeMaxMs);
+        }
+        EndTable();
+    }
+
+    // Walk back ring buffer to find first record of last frame, then display forward.
+    if (TreeNode("Last frame records"))
+    {
+        const int records_size = profiler->Records.Size;
+        const int frame_count = g.FrameCount - 1;
+        int count = 0;
+        while (count < profiler->RecordsCount && profiler->Records[(profiler->RecordsNext - 1 - count + records_size) % records_size].FrameCount >= frame_count)
+            count++;
+        for (int n = count - 1; n >= 0; n--)
+        {
+            const ImGuiProfilerRecord* rec = &profiler->Records[(profiler->RecordsNext - 1 - n + records_size) % records_size];
+            if (rec->FrameCount != frame_count || rec->TimeEnd == 0)
+                continue;
+            Text("%*s%s: %.3f ms", rec->Depth * 2, "", rec->Name, (double)(rec->TimeEnd - rec->TimeBegin) / 1000000.0);
+        }
+        TreePop();
+    }
+    TreePop();
+}
+#endif
+
 // [DEBUG] Display contents of ImGuiTabBar
 void ImGui::DebugNodeTabBar(ImGuiTabBar* tab_bar, const char* label)
 {
@@ -18273,6 +19623,9 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList
 void ImGui::DebugNodeFont(ImFont*) {}
 void ImGui::DebugNodeFontGlyphsForSrcMask(ImFont*, ImFontBaked*, int) {}
 void ImGui::DebugNodeStorage(ImGuiStorage*, const char*) {}
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+#endif
 void ImGui::DebugNodeTabBar(ImGuiTabBar*, const char*) {}
 void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
 void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
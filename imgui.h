@@ -47,8 +47,8 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextLog, ImGuiStorage, ImGuiListClipper, ImGuiTableSortStorage, ImGuiTableDataSource, ImGuiTreeView, Math Operators, ImColor)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionRangeStorage, ImGuiSelectionExternalStorage)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Texture API (ImTextureFormat, ImTextureStatus, ImTextureRect, ImTextureData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFontBaked, ImFont)
@@ -194,12 +194,15 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store heights of items for ImGuiListClipper, for lists with items of varying heights
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformIO;             // Interface between platform/renderer backends and ImGui (e.g. Clipboard, IME hooks). Extends ImGuiIO. In docking branch, this gets extended to support multi-viewports.
 struct ImGuiPlatformImeData;        // Platform IME data for io.PlatformSetImeDataFn() function.
 struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection state + apply multi-selection requests.
+struct ImGuiSelectionRange;         // A range of selected indices, stored by ImGuiSelectionRangeStorage.
+struct ImGuiSelectionRangeStorage;  // Optional helper to store multi-selection state as ranges of indices + apply multi-selection requests.
 struct ImGuiSelectionExternalStorage;//Optional helper to apply multi-selection requests to existing randomly accessible storage.
 struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMultiSelectIO)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
@@ -207,8 +210,14 @@ struct ImGuiStorage;                // Helper for key->value storage (container
 struct ImGuiStoragePair;            // Helper for key->value storage (pair)
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
+struct ImGuiTableSortStorage;       // Optional helper to maintain a sorted permutation of your items according to table sort specs.
+struct ImGuiTableDataSource;        // Optional helper to feed TableVirtualCells() with rows produced asynchronously (e.g. formatted on worker threads).
+struct ImGuiTreeView;               // Optional helper to maintain a flattened index of the visible nodes of a large tree, to display it with ImGuiListClipper.
+struct ImGuiTreeViewNode;           // A visible node in ImGuiTreeView
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
+struct ImGuiTextLog;                // Helper to hold an append-only log in chunks with a line index, optionally bounded and thread-safe, to display with TextLogView()
+struct ImGuiTextLogChunk;           // [Internal] Storage chunk of ImGuiTextLog
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
@@ -285,6 +294,9 @@ typedef ImS64 ImGuiSelectionUserData;
 // Callback and functions types
 typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);    // Callback function for ImGui::InputText()
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
+typedef void    (*ImGuiLogCallback)(void* user_data, const char* text, int text_len); // Callback function for ImGui::LogToCallback()
+typedef void    (*ImGuiTableCellCallback)(void* user_data, int row_n, int column_n); // Callback function for ImGui::TableVirtualCells()
+typedef const char* (*ImGuiTextFilterGetter)(void* user_data, int idx);         // Getter function for ImGuiTextFilter::PassFilterBatch()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
 
@@ -627,6 +639,7 @@ namespace ImGui
     IMGUI_API void          BulletText(const char* fmt, ...)                                IM_FMTARGS(1); // shortcut for Bullet()+Text()
     IMGUI_API void          BulletTextV(const char* fmt, va_list args)                      IM_FMTLIST(1);
     IMGUI_API void          SeparatorText(const char* label);                               // currently: formatted text with a horizontal line
+    IMGUI_API void          TextLogView(const char* str_id, ImGuiTextLog* log, const ImVec2& size = ImVec2(0, 0), ImGuiChildFlags child_flags = 0); // child window displaying lines of a ImGuiTextLog, using ImGuiListClipper. Calls log->Flush().
 
     // Widgets: Main
     // - Most widgets return true when the value has been changed or when pressed/selected
@@ -759,6 +772,7 @@ namespace ImGui
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
     IMGUI_API void          SetNextItemStorageID(ImGuiID storage_id);                           // set id to use for open/close storage (default to same as item id).
     IMGUI_API bool          TreeNodeGetOpen(ImGuiID storage_id);                                // retrieve tree node open/close state.
+    IMGUI_API bool          TreeViewNode(ImGuiTreeView* tree, int node_n, const char* label, ImGuiTreeNodeFlags flags = 0); // submit tree->Nodes[node_n], e.g. in a ImGuiListClipper loop. Indentation, open/close and tree lines are handled from the flattened index. Return true when open. Don't call TreePop().
 
     // Widgets: Selectables
     // - A selectable highlights when hovered, and can display another color when selected.
@@ -904,8 +918,11 @@ namespace ImGui
     IMGUI_API bool          BeginTable(const char* str_id, int columns, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0.0f, 0.0f), float inner_width = 0.0f);
     IMGUI_API void          EndTable();                                         // only call EndTable() if BeginTable() returns true!
     IMGUI_API void          TableNextRow(ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // append into the first cell of a new row. 'min_row_height' include the minimum top and bottom padding aka CellPadding.y * 2.0f.
+    IMGUI_API bool          TableNextRowCached(ImGuiID row_id, ImU64 row_version, ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // same as TableNextRow(), but return false when the row was replayed from its previous output because 'row_version' is unchanged and the row isn't interacted with: don't submit its cells then.
     IMGUI_API bool          TableNextColumn();                                  // append into the next column (or first column of next row if currently in last column). Return true when column is visible.
     IMGUI_API bool          TableSetColumnIndex(int column_n);                  // append into the specified column. Return true when column is visible.
+    IMGUI_API void          TableVirtualCells(int rows_count, ImGuiTableCellCallback cell_func, void* user_data, float row_height = -1.0f); // submit 'rows_count' rows, calling cell_func() only for cells in view (rows clipped with ImGuiListClipper, columns clipped by table layout). row_height <= 0.0f: measure first row.
+    IMGUI_API void          TableVirtualCells(ImGuiTableDataSource* source, float row_height = -1.0f); // submit source->RowsCount rows as text cells fetched from 'source', drawing placeholders for rows which are not ready yet. row_height <= 0.0f: single line of text.
 
     // Tables: Headers & Columns declaration
     // - Use TableSetupColumn() to specify label, resizing policy, default width/weight, id, various other flags etc.
@@ -962,6 +979,7 @@ namespace ImGui
     IMGUI_API void          LogToTTY(int auto_open_depth = -1);                                 // start logging to tty (stdout)
     IMGUI_API void          LogToFile(int auto_open_depth = -1, const char* filename = NULL);   // start logging to file
     IMGUI_API void          LogToClipboard(int auto_open_depth = -1);                           // start logging to OS clipboard
+    IMGUI_API void          LogToCallback(ImGuiLogCallback callback, void* user_data, int auto_open_depth = -1); // start logging to your callback, called with batches of text: see comments in LOGGING/CAPTURING section of imgui.cpp.
     IMGUI_API void          LogFinish();                                                        // stop logging (close file, etc.)
     IMGUI_API void          LogButtons();                                                       // helper to display buttons for logging to tty/file/clipboard
     IMGUI_API void          LogText(const char* fmt, ...) IM_FMTARGS(1);                        // pass text data straight to log (without being displayed)
@@ -1293,6 +1311,12 @@ enum ImGuiInputTextFlags_
     //   The CPU cost is very roughly proportional to text length, so a 10 KB buffer should cost about ten times less.
     ImGuiInputTextFlags_WordWrap            = 1 << 24,  // InputTextMultiline(): word-wrap lines that are too long.
 
+    // Large buffers
+    // - By default an active InputText() compares its internal copy with 'buf' every frame and writes it back on change,
+    //   which allows using InputText() on a temporary buffer but costs O(N) per frame on very large texts.
+    // - Text is stored contiguously, so each insertion/deletion also costs O(N) as it moves the rest of the text (regardless of this flag).
+    ImGuiInputTextFlags_NoLiveEdit          = 1 << 25,  // Don't write to 'buf' while active: edits are applied when deactivated (validating, tabbing out, clicking elsewhere), which is when InputText() returns true. Escape reverts to the contents of 'buf'. 'buf' must persist and not be modified by you while active.
+
     // Obsolete names
     //ImGuiInputTextFlags_AlwaysInsertMode  = ImGuiInputTextFlags_AlwaysOverwrite   // [renamed in 1.82] name was not matching behavior
 };
@@ -2073,6 +2097,7 @@ enum ImGuiTableFlags_
     ImGuiTableFlags_SortTristate               = 1 << 27,  // Allow no sorting, disable default sorting. TableGetSortSpecs() may return specs where (SpecsCount == 0).
     // Miscellaneous
     ImGuiTableFlags_HighlightHoveredColumn     = 1 << 28,  // Highlight column headers when hovered (may evolve into a fuller highlight)
+    ImGuiTableFlags_Virtualized                = 1 << 29,  // Allow very wide tables (up to 16384 columns instead of 512). Submit contents with TableVirtualCells() so only cells in view are visited. Clipped columns never report their contents width: prefer fixed width columns.
 
     // [Internal] Combinations and masks
     ImGuiTableFlags_SizingMask_                = ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_SizingFixedSame | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_SizingStretchSame,
@@ -2433,12 +2458,15 @@ struct ImGuiIO
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigInputTextEnterKeepActive; // = false          // [BETA] Pressing Enter will reactivate item and select all text (single-line only).
+    int         ConfigInputTextUndoMemoryBudget;// = 0              // [EXPERIMENTAL] When > 0, InputText() uses a growable undo history using up to this many bytes (oldest steps are discarded), instead of a fixed one (99 steps, 999 characters). Consecutive typing is coalesced into word-sized steps. Multi-caret edits always use it (with a 1 MB budget when this is 0).
+    bool        ConfigInputTextUndoCompress;    // = false          // [EXPERIMENTAL] Compress large undo steps (e.g. deleted blocks of text) to fit more history in io.ConfigInputTextUndoMemoryBudget.
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires ImGuiBackendFlags_HasMouseCursors for better mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly;  // = false      // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] Ctrl+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
-    float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to free them as soon as unused, FLT_MAX to never free them.
+    bool        ConfigMemoryCompactDrawLists;   // = true           // Allow freeing ImDrawList buffers of unused windows. Disable to keep their capacity so reappearing windows (popups, tooltips) don't need to grow them again.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2499,6 +2527,15 @@ struct ImGuiIO
     // Option to audit .ini data
     bool        ConfigDebugIniSettings;         // = false          // Save .ini data with extra comments (particularly helpful for Docking, but makes saving slower)
 
+    // Options to audit heap allocations in steady-state frames.
+    // - Once a stable UI has warmed up, a frame should not need any call to MemAlloc(). A frame is considered steady-state
+    //   after ConfigDebugAllocSteadyStateFrames consecutive frames without allocations.
+    // - Allocations happening in a steady-state frame are recorded along with their call site (current window, last item, return address),
+    //   visible in 'Metrics/Debugger->Memory allocations' and reported in the Debug Log. Tracking then restarts from zero.
+    // - Consider setting io.ConfigMemoryCompactTimer = FLT_MAX so buffers of windows which are not always visible are never released.
+    int         ConfigDebugAllocSteadyStateFrames;// = 0            // Number of allocation-free frames after which allocations are reported. 0 to disable.
+    bool        ConfigDebugAllocSteadyStateAssert;// = false        // Assert when an allocation happens in a steady-state frame. Use a debugger to inspect the call-stack.
+
     //------------------------------------------------------------------
     // Platform Identifiers
     // (the imgui_impl_xxxx backend files are setting those up for you)
@@ -2663,6 +2700,7 @@ struct ImGuiInputTextCallbackData
 
     // Helper functions for text manipulation.
     // Use those function to benefit from the CallbackResize behaviors. Calling those function reset the selection.
+    // They also let us know which part of the text changed, which is faster with large texts. Don't mix them with writing to Buf directly in a same callback.
     IMGUI_API ImGuiInputTextCallbackData();
     IMGUI_API void      DeleteChars(int pos, int bytes_count);
     IMGUI_API void      InsertChars(int pos, const char* text, const char* text_end = NULL);
@@ -2705,7 +2743,7 @@ struct ImGuiPayload
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiTextLog, ImGuiStorage, ImGuiListClipper, ImGuiTableSortStorage, ImGuiTableDataSource, ImGuiTreeView, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2726,11 +2764,17 @@ struct ImGuiOnceUponAFrame
 };
 
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
+// - To filter large lists, PassFilterBatch() produces the list of passing indices, to display with ImGuiListClipper.
+//   Call it again only when the filter or the list changed (e.g. when Draw() returns true).
+// - PassFilter() and PassFilterBatch() don't modify the filter: you may filter disjoint ranges from multiple threads,
+//   each with its own output vector, then concatenate the outputs in range order.
 struct ImGuiTextFilter
 {
     IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
     IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API int       PassFilterBatch(const char* const* items, int items_count, ImVector<int>* out_indices, int index_base = 0) const; // Append (index_base + n) for each items[n] passing the filter, return number of indices appended. Use out_indices with ImGuiListClipper.
+    IMGUI_API int       PassFilterBatch(ImGuiTextFilterGetter getter, void* user_data, int idx_begin, int idx_end, ImVector<int>* out_indices) const; // Same for items provided by a getter, in [idx_begin, idx_end) range.
     IMGUI_API void      Build();
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
@@ -2773,6 +2817,53 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Append-only text log stored in chunks, with a line index. Display with TextLogView(), or with ImGuiListClipper + GetLine().
+// - USING THIS IS NOT MANDATORY. This is only a helper and not a required API.
+// - Text is stored in chunks of ChunkSize bytes: appending never reallocates nor copies older text. A line never spans two chunks.
+// - Ring mode: when MaxSize > 0, oldest chunks are dropped (and their memory reused) to keep size under MaxSize, without moving text.
+//   Lines are numbered from the oldest line still stored. GetLinesDropped() tells how many lines were dropped since clear().
+// - Thread-safety: set LockFunc to append from other threads. Appended text is then queued, and Flush() moves it into the log.
+//   Everything but append()/appendf()/appendfv() must be called from the thread displaying the log (TextLogView() calls Flush()).
+//   The queue is not bounded by MaxSize: if the log isn't displayed with TextLogView() every frame, call Flush() yourself regularly.
+//   Dear ImGui itself stays thread-agnostic: LockFunc locks/unlocks a mutex of yours.
+// Usage:
+//   static ImGuiTextLog log;                          // e.g. log.MaxSize = 64 * 1024 * 1024;
+//   log.appendf("[%05d] Hello\n", ImGui::GetFrameCount());
+//   ImGui::TextLogView("##log", &log);
+struct ImGuiTextLog
+{
+    // Members
+    int             ChunkSize;          // = 64 KB  // Size of storage chunks. Longer lines get a chunk of their own.
+    int             MaxSize;            // = 0      // Ring mode: when > 0, drop oldest chunks while the log is bigger than this.
+    bool            AutoScroll;         // = true   // TextLogView(): keep scrolling to the bottom when new lines are added, if already at the bottom.
+    void            (*LockFunc)(void* user_data, bool lock); // = NULL // Optional: lock (lock == true) or unlock a mutex of yours, to allow appending from other threads.
+    void*           LockUserData;       // = NULL
+    ImVector<ImGuiTextLogChunk*> Chunks;// [Internal]
+    ImGuiTextLogChunk* _FreeChunk;      // [Internal] Dropped chunk kept for reuse
+    ImVector<char>  _Pending;           // [Internal] Text appended while LockFunc is set, waiting for Flush()
+    ImVector<char>  _PendingFlush;      // [Internal]
+    int             _Size;              // [Internal]
+    int             _LinesCount;        // [Internal]
+    int             _LinesDropped;      // [Internal]
+    ImGuiID         _ViewWindowID;      // [Internal] TextLogView(): child window, to keep its contents in place when lines are dropped
+    int             _ViewLinesDropped;  // [Internal]
+    int             _ViewLinesCount;    // [Internal]
+
+    // Methods
+    IMGUI_API ImGuiTextLog();
+    IMGUI_API ~ImGuiTextLog();
+    IMGUI_API void          clear();
+    IMGUI_API void          append(const char* str, const char* str_end = NULL);
+    IMGUI_API void          appendf(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API void          appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
+    IMGUI_API void          Flush();                                                    // Move text appended with LockFunc set into the log. Called by TextLogView().
+    IMGUI_API const char*   GetLine(int line_n, const char** out_line_end) const;       // Return line text, excluding its trailing \n. 'line_n' in [0, GetLinesCount()).
+    int                     GetLinesCount() const   { return _LinesCount; }
+    int                     GetLinesDropped() const { return _LinesDropped; }
+    int                     size() const            { return _Size; }
+    bool                    empty() const           { return _Size == 0; }
+};
+
 // [Internal] Key+Value for ImGuiStorage
 struct ImGuiStoragePair
 {
@@ -2855,6 +2946,16 @@ enum ImGuiListClipperFlags_
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
 // - The clipper also handles various subtleties related to keyboard/gamepad navigation, wrapping etc.
+// Items of varying heights:
+// - Use BeginWithHeights() with a persistent ImGuiListClipperHeights instance, which stores the height of every item.
+// - Items are yielded one at a time (DisplayEnd == DisplayStart + 1) and the height of every submitted item is measured back into the storage.
+//   Items which have never been submitted use ImGuiListClipperHeights::DefaultHeight. You may also set known heights ahead with SetHeight()/Build().
+//   static ImGuiListClipperHeights heights;
+//   ImGuiListClipper clipper;
+//   clipper.BeginWithHeights(lines_count, &heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", lines[i]);
 struct ImGuiListClipper
 {
     int             DisplayStart;       // First item to display, updated by each call to Step()
@@ -2867,12 +2968,14 @@ struct ImGuiListClipper
     double          StartSeekOffsetY;   // [Internal] Account for frozen rows in a table and initial loss of precision in very large windows.
     ImGuiContext*   Ctx;                // [Internal] Parent UI context
     void*           TempData;           // [Internal] Internal data
+    ImGuiListClipperHeights* ItemsHeights; // [Internal] Per-item heights, when using BeginWithHeights()
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step, and you can call SeekCursorForItem() manually if you need)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginWithHeights(int items_count, ImGuiListClipperHeights* items_heights); // Items of varying heights. 'items_heights' is resized to items_count, existing heights are preserved.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2893,6 +2996,147 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Heights of items for ImGuiListClipper::BeginWithHeights(), for lists with items of varying heights.
+// Keep an instance around for the lifetime of your list: measured heights are cached in it.
+// - Heights include vertical spacing between items (same as ImGuiListClipper::ItemsHeight).
+// - Stored as a Fenwick tree (binary indexed tree) of heights: updating a height, converting an item index to a position
+//   and converting a position to an item index are O(log N). Appending items is O(log N) per item.
+struct ImGuiListClipperHeights
+{
+    float               DefaultHeight;  // Height of items which haven't been measured or set. Default to GetTextLineHeightWithSpacing() at the time of first BeginWithHeights().
+    ImVector<float>     Heights;        // Height of each item.
+    ImVector<double>    Tree;           // [Internal] Fenwick tree over Heights[]: Tree[n-1] stores sum of heights over items [n - lowbit(n), n).
+
+    ImGuiListClipperHeights()           { DefaultHeight = 0.0f; }
+    void                Clear()         { Heights.clear(); Tree.clear(); }
+    int                 GetItemsCount() const       { return Heights.Size; }
+    float               GetHeight(int item_n) const { return Heights[item_n]; }
+    double              GetTotalHeight() const      { return GetOffset(Heights.Size); }
+    IMGUI_API void      Resize(int items_count);                    // Add items with DefaultHeight or remove trailing items.
+    IMGUI_API void      Build(int items_count, float (*get_height_func)(void* user_data, int item_n), void* user_data); // Rebuild from your own data in O(N).
+    IMGUI_API void      SetHeight(int item_n, float height);        // O(log N)
+    IMGUI_API void      SetAllHeights(float height);                // e.g. Invalidate all measurements when wrap width changed. O(N)
+    IMGUI_API double    GetOffset(int item_n) const;                // Sum of heights of items [0, item_n). O(log N)
+    IMGUI_API int       FindItemAtOffset(double offset) const;      // Item containing given offset from the top of the list, clamped to [0, ItemsCount-1]. O(log N)
+};
+
+// Helper: Maintain a sorted permutation of your items according to table sort specs (see TableGetSortSpecs()).
+// - USING THIS IS NOT MANDATORY. This is only a helper and not a required API.
+// - You provide CompareFunc() comparing two items on a single column, in ascending order.
+// - Call ApplySortSpecs() every frame. It only performs work when sort specs changed, items count changed, or items were marked dirty:
+//   - Sort specs changed: full stable merge sort. With multiple specs (ImGuiTableFlags_SortMulti), columns are compared in priority order.
+//   - Items appended, removed at the end or marked with MarkItemDirty(): only those items are sorted then merged back in O(N + K log K).
+// - Ties are broken using item index: the resulting order is deterministic and equal items keep their relative order.
+// - Optionally provide ParallelForFunc() to sort large inputs in chunks on your own worker threads. CompareFunc() must be thread-safe then.
+// Usage:
+//   static ImGuiTableSortStorage sort_storage;
+//   sort_storage.UserData = (void*)my_items;
+//   sort_storage.CompareFunc = [](void* user_data, const ImGuiTableColumnSortSpecs* spec, int a, int b) { return MyCompare(((MyItem*)user_data)[a], ((MyItem*)user_data)[b], spec->ColumnIndex); };
+//   sort_storage.ApplySortSpecs(ImGui::TableGetSortSpecs(), my_items_count);
+//   [...] then display row_n using: MyItem* item = &my_items[sort_storage.Items[row_n]];
+struct ImGuiTableSortStorage
+{
+    // Members
+    ImVector<int>   Items;              //          // Sorted permutation of [0, items_count): Items[row_n] == index of your item to display at row_n.
+    void*           UserData;           // = NULL   // User data for use by adapter functions        // e.g. sort_storage.UserData = (void*)my_items;
+    int             (*CompareFunc)(void* user_data, const ImGuiTableColumnSortSpecs* spec, int item_a, int item_b); // Compare two items on spec->ColumnIndex (or spec->ColumnUserID) in ascending order. Return <0, 0 or >0.
+    void            (*ParallelForFunc)(void* user_data, void (*job_func)(void* job_data, int job_n), void* job_data, int jobs_count); // = NULL // Optional: call job_func(job_data, n) for n in [0, jobs_count), possibly concurrently, and return once all are done.
+    int             ParallelMinItems;   // = 65536  // Minimum items count to use ParallelForFunc().
+    bool            _FullSortRequest;   // [Internal]
+    ImVector<ImGuiTableColumnSortSpecs> _Specs; // [Internal] Copy of last applied sort specs.
+    ImVector<int>   _DirtyItems;        // [Internal] Items marked with MarkItemDirty() since last ApplySortSpecs().
+    ImVector<ImU32> _DirtyMask;         // [Internal]
+    ImVector<int>   _Temp;              // [Internal]
+
+    // Methods
+    IMGUI_API ImGuiTableSortStorage();
+    IMGUI_API bool  ApplySortSpecs(ImGuiTableSortSpecs* sort_specs, int items_count); // Update Items[] and clear sort_specs->SpecsDirty. Return true if Items[] may have changed. Passing NULL or no specs gives identity order.
+    IMGUI_API void  MarkItemDirty(int item_idx);    // Notify that sort keys of an item changed since last ApplySortSpecs().
+    IMGUI_API void  MarkAllDirty();                 // Request a full sort on next ApplySortSpecs(), e.g. after changing most of your data.
+    IMGUI_API void  Clear();                        // Clear all storage.
+};
+
+// Helper: Data source for TableVirtualCells(), for tables whose rows are expensive to produce (e.g. network-fed, or requiring lookups to format).
+// - USING THIS IS NOT MANDATORY. This is only a helper and not a required API.
+// - When rows in view leave the last requested range, RequestRowsFunc() is called with the new range (visible rows + PrefetchRows on each side).
+//   Queue the formatting of missing rows in that range (e.g. on your own worker threads) and return immediately. Rows outside of it may be evicted.
+// - GetCellTextFunc() is called from the main thread for each cell in view. Return NULL while the row is not ready: a placeholder is drawn instead.
+//   Synchronizing with your worker threads is up to you (e.g. publish each row with an atomic 'ready' flag once its strings are written).
+// - Rows all have the same height so scrolling doesn't jump when placeholders are replaced. Dear ImGui itself stays thread-agnostic.
+// Usage:
+//   static ImGuiTableDataSource source;
+//   source.UserData = (void*)my_cache;
+//   source.RowsCount = my_cache->RowsCount;
+//   source.RequestRowsFunc = [](void* user_data, int row_start, int row_end) { ((MyCache*)user_data)->QueueRows(row_start, row_end); };
+//   source.GetCellTextFunc = [](void* user_data, int row_n, int column_n, const char** out_text_end) { return ((MyCache*)user_data)->TryGetCell(row_n, column_n); };
+//   ImGui::TableVirtualCells(&source);
+struct ImGuiTableDataSource
+{
+    // Members
+    void*           UserData;           // = NULL   // User data for use by adapter functions        // e.g. source.UserData = (void*)my_cache;
+    int             RowsCount;          // = 0      // Number of rows.
+    int             PrefetchRows;       // = 32     // Rows requested beyond each edge of the visible range, so small scrolls don't need a new request.
+    void            (*RequestRowsFunc)(void* user_data, int row_start, int row_end); // = NULL // Optional: request rows [row_start, row_end) to be made ready. Called at most once per frame.
+    const char*     (*GetCellTextFunc)(void* user_data, int row_n, int column_n, const char** out_text_end); // Return cell text, or NULL if not ready. Setting *out_text_end is optional (zero-terminated otherwise).
+    int             RequestedRowStart;  // = -1     // [Read-only] Last range passed to RequestRowsFunc(). Call ClearRequests() to request again on next frame, e.g. after invalidating your cache.
+    int             RequestedRowEnd;    // = -1
+
+    // Methods
+    IMGUI_API ImGuiTableDataSource();
+    void            ClearRequests()     { RequestedRowStart = RequestedRowEnd = -1; }
+};
+
+// Helper: Flattened index of the visible nodes of a tree, to display very large trees with ImGuiListClipper and TreeViewNode().
+// - USING THIS IS NOT MANDATORY. This is only a helper and not a required API.
+// - You describe your tree with GetChildrenCountFunc() and GetChildFunc(), using your own node indices. The root is node -1 and is not displayed.
+// - Nodes[] lists visible nodes (whose parents are all open) in display order. Open state is stored in OpenStorage, keyed by your node index.
+// - Opening or closing a node only inserts or removes its visible descendants into Nodes[]: TreeViewNode() queues those changes,
+//   ApplyRequests() applies them. Call Rebuild() after modifying the structure of your tree.
+// - Nodes are not pushed on the ID stack: TreeViewNode() uses your node index as ID. Enclose the tree in PushID()/PopID() if needed.
+// - Within BeginMultiSelect()/EndMultiSelect(), TreeViewNode() sets the selection user data to the index in Nodes[].
+//   With ImGuiSelectionBasicStorage, set an AdapterIndexToStorageId() returning Nodes[idx].Node, and pass ImGuiTreeNodeFlags_Selected yourself.
+// Usage:
+//   static ImGuiTreeView tree;
+//   if (tree.GetChildFunc == NULL)
+//   {
+//       tree.UserData = (void*)my_tree;
+//       tree.GetChildrenCountFunc = [](void* user_data, int node) { return ((MyTree*)user_data)->GetChildrenCount(node); };
+//       tree.GetChildFunc = [](void* user_data, int node, int child_n) { return ((MyTree*)user_data)->GetChild(node, child_n); };
+//       tree.Rebuild();
+//   }
+//   tree.ApplyRequests();
+//   ImGuiListClipper clipper;
+//   clipper.Begin(tree.Nodes.Size);
+//   while (clipper.Step())
+//       for (int node_n = clipper.DisplayStart; node_n < clipper.DisplayEnd; node_n++)
+//           ImGui::TreeViewNode(&tree, node_n, my_tree->GetName(tree.Nodes[node_n].Node));
+struct ImGuiTreeViewNode
+{
+    int             Node;               // Your node index
+    ImU32           LinesMask;          // [Internal] Bit N set when the parent at depth N+1 (or this node) has a next sibling, for drawing tree lines of the first 32 levels
+    ImS16           Depth;              // Depth (0 for children of the root)
+    bool            IsOpen;             // [Internal] Descendants are currently in Nodes[]
+};
+
+struct ImGuiTreeView
+{
+    // Members
+    ImVector<ImGuiTreeViewNode> Nodes;  //          // Visible nodes in display order. Use Nodes.Size as items count for ImGuiListClipper.
+    ImGuiStorage    OpenStorage;        //          // Open state of your nodes: OpenStorage.GetInt((ImGuiID)node) != 0.
+    void*           UserData;           // = NULL   // User data for use by adapter functions        // e.g. tree.UserData = (void*)my_tree;
+    int             (*GetChildrenCountFunc)(void* user_data, int node);             // Return children count of 'node' (-1 for the root).
+    int             (*GetChildFunc)(void* user_data, int node, int child_n);        // Return your index of the n-th child of 'node' (-1 for the root).
+    ImVector<int>   _Requests;          // [Internal] Indices in Nodes[] whose open state changed, queued by TreeViewNode().
+
+    // Methods
+    IMGUI_API ImGuiTreeView();
+    IMGUI_API void  Rebuild();                              // Rebuild Nodes[] from your tree and OpenStorage. O(number of visible nodes).
+    IMGUI_API void  ApplyRequests();                        // Apply open/close changes queued by TreeViewNode() during the previous frame. Call before using Nodes.Size.
+    IMGUI_API void  SetNodeOpen(int node_n, bool open);     // Open or close Nodes[node_n] immediately. O(number of visible nodes).
+    bool            IsNodeOpen(int node) const              { return OpenStorage.GetInt((ImGuiID)node, 0) != 0; }
+    void            Clear()                                 { Nodes.clear(); OpenStorage.Clear(); _Requests.clear(); }
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2984,7 +3228,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage, ImGuiSelectionRangeStorage)
 //-----------------------------------------------------------------------------
 
 // Multi-selection system
@@ -3102,6 +3346,7 @@ struct ImGuiSelectionRequest
 // - use the AdapterIndexToStorageId() indirection layer to abstract how persistent selection data is derived from an index.
 // - use decently optimized logic to allow queries and insertion of very large selection sets.
 // - do not preserve selection order.
+// For very large index-based selections (e.g. a clipped list of millions of items), see ImGuiSelectionRangeStorage.
 // Many combinations are possible depending on how you prefer to store your items and how you prefer to store your selection.
 // Large applications are likely to eventually want to get rid of this indirection layer and do their own thing.
 // See https://github.com/ocornut/imgui/wiki/Multi-Select for details and pseudo-code using this helper.
@@ -3126,6 +3371,37 @@ struct ImGuiSelectionBasicStorage
     inline ImGuiID  GetStorageIdFromIndex(int idx)              { return AdapterIndexToStorageId(this, idx); }  // Convert index to item id based on provided adapter.
 };
 
+// Optional helper to store multi-selection state as sorted ranges of indices + apply multi-selection requests.
+// - Same usage as ImGuiSelectionBasicStorage, but items are identified by their index: the ImGuiID returned by GetNextSelectedItem() is the index.
+// - Applying a SetAll/SetRange request or calling Contains() is O(log R) (+ a memmove of the ranges after the edited one), R being the number
+//   of disjoint ranges, instead of being proportional to the number of items. e.g. Ctrl+A or Shift+Click over 1M items only touches one range.
+// - Iterate selection with 'void* it = NULL; ImGuiID id; while (selection.GetNextSelectedItem(&it, &id)) { ... }', or iterate Ranges[] directly.
+// - Indices are not stable if your items are reordered/inserted/deleted: you would need to update the selection accordingly.
+// - Do not preserve selection order.
+struct ImGuiSelectionRange
+{
+    int             First;          // First selected index
+    int             Last;           // Last selected index (inclusive)
+};
+
+struct ImGuiSelectionRangeStorage
+{
+    // Members
+    int             Size;           //          // Number of selected items, maintained by this helper.
+    ImVector<ImGuiSelectionRange> Ranges;       // Sorted, disjoint and non-adjacent ranges of selected indices.
+    int             _IterRange;     // [Internal] Range visited by last GetNextSelectedItem() call
+
+    // Methods
+    IMGUI_API ImGuiSelectionRangeStorage();
+    IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests coming from BeginMultiSelect() and EndMultiSelect() functions. It uses 'items_count' passed to BeginMultiSelect()
+    IMGUI_API bool  Contains(int idx) const;                    // Query if an item index is in selection.
+    IMGUI_API void  Clear();                                    // Clear selection
+    IMGUI_API void  Swap(ImGuiSelectionRangeStorage& r);        // Swap two selections
+    IMGUI_API void  SetItemSelected(int idx, bool selected);    // Add/remove an item from selection
+    IMGUI_API void  SetRangeSelected(int first, int last, bool selected); // Add/remove an inclusive range of items from selection (generally done by ApplyRequests() function)
+    IMGUI_API bool  GetNextSelectedItem(void** opaque_it, ImGuiID* out_id); // Iterate selection with 'void* it = NULL; ImGuiID id; while (selection.GetNextSelectedItem(&it, &id)) { ... }'
+};
+
 // Optional helper to apply multi-selection requests to existing randomly accessible storage.
 // Convenient if you want to quickly wire multi-select API on e.g. an array of bool or items storing their own selection state.
 struct ImGuiSelectionExternalStorage
@@ -4005,6 +4281,10 @@ struct ImGuiPlatformIO
     void*       Platform_ImeUserData;
     //void      (*SetPlatformImeDataFn)(ImGuiViewport* viewport, ImGuiPlatformImeData* data); // [Renamed to platform_io.PlatformSetImeDataFn in 1.91.1]
 
+    // Optional: High resolution clock, only used by the built-in profiler (when IMGUI_ENABLE_PROFILER is defined in imconfig.h)
+    // (default to use QueryPerformanceCounter() on Windows, clock_gettime() on Linux/Mac. Should return a monotonic time in nanoseconds)
+    ImU64       (*Platform_GetTimeNsFn)(ImGuiContext* ctx);
+
     // Optional: Platform locale
     // [Experimental] Configure decimal point e.g. '.' or ',' useful for some languages (e.g. German), generally pulled from *localeconv()->decimal_point
     ImWchar     Platform_LocaleDecimalPoint;     // '.'
@@ -527,6 +527,11 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Enable blinking cursor (optional as some users consider it to be distracting).");
             ImGui::Checkbox("io.ConfigInputTextEnterKeepActive", &io.ConfigInputTextEnterKeepActive);
             ImGui::SameLine(); HelpMarker("Pressing Enter will reactivate item and select all text (single-line only).");
+            ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+            ImGui::DragInt("io.ConfigInputTextUndoMemoryBudget", &io.ConfigInputTextUndoMemoryBudget, 1024.0f, 0, 64 * 1024 * 1024, "%d bytes", ImGuiSliderFlags_AlwaysClamp);
+            ImGui::SameLine(); HelpMarker("[EXPERIMENTAL] When > 0, InputText() uses a growable undo history using up to this many bytes, instead of a fixed one.\nTakes effect when activating a text field.");
+            ImGui::Checkbox("io.ConfigInputTextUndoCompress", &io.ConfigInputTextUndoCompress);
+            ImGui::SameLine(); HelpMarker("[EXPERIMENTAL] Compress large undo steps to fit more history in io.ConfigInputTextUndoMemoryBudget.");
             ImGui::Checkbox("io.ConfigDragClickToInputText", &io.ConfigDragClickToInputText);
             ImGui::SameLine(); HelpMarker("Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving).");
             ImGui::Checkbox("io.ConfigMacOSXBehaviors", &io.ConfigMacOSXBehaviors);
@@ -566,6 +571,11 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Option to deactivate io.AddFocusEvent(false) handling. May facilitate interactions with a debugger when focus loss leads to clearing inputs data.");
             ImGui::Checkbox("io.ConfigDebugIniSettings", &io.ConfigDebugIniSettings);
             ImGui::SameLine(); HelpMarker("Option to save .ini data with extra comments (particularly helpful for Docking, but makes saving slower).");
+            ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+            ImGui::DragInt("io.ConfigDebugAllocSteadyStateFrames", &io.ConfigDebugAllocSteadyStateFrames, 1.0f, 0, 3600);
+            ImGui::SameLine(); HelpMarker("Report heap allocations happening after this many consecutive allocation-free frames. 0 to disable.\n\nSee 'Metrics/Debugger->Memory allocations' for reported call sites.");
+            ImGui::Checkbox("io.ConfigMemoryCompactDrawLists", &io.ConfigMemoryCompactDrawLists);
+            ImGui::SameLine(); HelpMarker("Allow freeing draw list buffers of windows unused for io.ConfigMemoryCompactTimer seconds. Disable to keep their capacity.");
 
             ImGui::TreePop();
             ImGui::Spacing();
@@ -9738,7 +9748,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to TextWrapped(), clipped with varying heights\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -9774,6 +9785,33 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Multiple calls to TextWrapped(), with lines of varying heights.
+            // The clipper measures heights of submitted lines into a persistent ImGuiListClipperHeights storage.
+            // Lines which have never been displayed use a default height. When the wrapping width changes, we reset measurements.
+            static ImGuiListClipperHeights heights;
+            static float heights_wrap_width = 0.0f;
+            const float wrap_width = ImGui::GetContentRegionAvail().x;
+            if (heights_wrap_width != wrap_width)
+            {
+                heights.SetAllHeights(ImGui::GetTextLineHeightWithSpacing());
+                heights_wrap_width = wrap_width;
+            }
+            const char* sentences[] =
+            {
+                "The quick brown fox jumps over the lazy dog",
+                "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.",
+                "Hello",
+                "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.",
+            };
+            ImGuiListClipper clipper;
+            clipper.BeginWithHeights(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                    ImGui::TextWrapped("%i %s", i, sentences[(i * 7) % (int)IM_COUNTOF(sentences)]);
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
@@ -2147,7 +2147,9 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
     {
-        _Channels.reserve(channels_count); // Avoid over reserving since this is likely to stay stable
+        // Avoid over reserving on first use since this is likely to stay stable, but grow geometrically afterward
+        // as callers such as tables may vary their channels count from one frame to another (e.g. based on visible columns).
+        _Channels.reserve(old_channels_count == 0 ? channels_count : _Channels._grow_capacity(channels_count));
         _Channels.resize(channels_count);
     }
     _Count = channels_count;
@@ -2180,6 +2182,8 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     draw_list->_PopUnusedDrawCmd();
 
     // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // A command merged into the last command of a previous channel is marked by clearing its ElemCount (non-callback
+    // commands with no elements are otherwise always trailing and popped), and skipped when writing commands below.
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
     ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
@@ -2200,14 +2204,15 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
                 // Merge previous channel last draw command with current channel first draw command if matching.
                 last_cmd->ElemCount += next_cmd->ElemCount;
                 idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+                next_cmd->ElemCount = 0;
             }
         }
-        if (ch._CmdBuffer.Size > 0)
+        const int cmd_start = (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.Data[0].ElemCount == 0 && ch._CmdBuffer.Data[0].UserCallback == NULL) ? 1 : 0;
+        if (ch._CmdBuffer.Size > cmd_start)
             last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
+        new_cmd_buffer_count += ch._CmdBuffer.Size - cmd_start;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        for (int cmd_n = cmd_start; cmd_n < ch._CmdBuffer.Size; cmd_n++)
         {
             ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
             idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
@@ -2222,7 +2227,8 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        const int cmd_start = (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.Data[0].ElemCount == 0 && ch._CmdBuffer.Data[0].UserCallback == NULL) ? 1 : 0;
+        if (int sz = ch._CmdBuffer.Size - cmd_start) { memcpy(cmd_write, ch._CmdBuffer.Data + cmd_start, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
     draw_list->_IdxWritePtr = idx_write;
@@ -2283,6 +2289,7 @@ void ImDrawData::Clear()
 // as long at it is expected that the result will be later merged into draw_data->CmdLists[].
 void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list)
 {
+    IMGUI_PROFILER_ZONE("AddDrawListToDrawData");
     if (draw_list->CmdBuffer.Size == 0)
         return;
     if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
@@ -5768,6 +5775,7 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 // DO NOT CALL DIRECTLY THIS WILL CHANGE WILDLY IN 2026. Use ImDrawList::AddText().
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, ImDrawTextFlags flags)
 {
+    IMGUI_PROFILER_ZONE("RenderText");
     // Align to be pixel perfect
 begin:
     float x = IM_TRUNC(pos.x);
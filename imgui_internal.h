@@ -63,6 +63,9 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE) && !defined(_M_ARM64) && !defined(_M_ARM64EC)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
@@ -138,6 +141,8 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
+struct ImGuiTextDirtyRange;         // Track which part of a text buffer was modified since a reference point.
+struct ImGuiNumberFormat;           // Parsed numeric format, for formatting numbers without vsnprintf()
 
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
@@ -156,7 +161,9 @@ struct ImGuiDeactivatedItemData;    // Data for IsItemDeactivated()/IsItemDeacti
 struct ImGuiErrorRecoveryState;     // Storage of stack sizes for error handling and recovery
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
+struct ImGuiInputTextCaret;         // Additional caret of a multi-line InputText()
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
+struct ImGuiInputTextUndoHistory;   // Growable undo/redo history for InputText(), used when io.ConfigInputTextUndoMemoryBudget > 0 or after a multi-caret edit
 struct ImGuiLastItemData;           // Status storage for last submitted items
 struct ImGuiLocEntry;               // A localization entry.
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
@@ -181,6 +188,7 @@ struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTextViewer;             // Storage for TextViewer(): line index, tokenizer states and cache of a large read-only text buffer
 struct ImGuiTreeNodeStackData;      // Temporary storage for TreeNode().
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
@@ -326,6 +334,19 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
 #endif // #ifndef IM_DEBUG_BREAK
 
+// Return address of current function, used to report allocation call sites (see io.ConfigDebugAllocSteadyStateFrames). May be redefined yourself.
+#ifndef IM_RETURN_ADDRESS
+#if defined(_MSC_VER) && !defined(__clang__)
+#define IM_RETURN_ADDRESS() _ReturnAddress()
+extern "C" void* _ReturnAddress(void);
+#pragma intrinsic(_ReturnAddress)
+#elif defined(__GNUC__) || defined(__clang__)
+#define IM_RETURN_ADDRESS() __builtin_return_address(0)
+#else
+#define IM_RETURN_ADDRESS() NULL
+#endif
+#endif // #ifndef IM_RETURN_ADDRESS
+
 // Format specifiers, printing 64-bit hasn't been decently standardized...
 // In a real application you should be using PRId64 and PRIu64 from <inttypes.h> (non-windows) and on Windows define them yourself.
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -418,6 +439,10 @@ IMGUI_API const char*   ImParseFormatTrimDecorations(const char* format, char* b
 IMGUI_API void          ImParseFormatSanitizeForPrinting(const char* fmt_in, char* fmt_out, size_t fmt_out_size);
 IMGUI_API const char*   ImParseFormatSanitizeForScanning(const char* fmt_in, char* fmt_out, size_t fmt_out_size);
 IMGUI_API int           ImParseFormatPrecision(const char* format, int default_value);
+IMGUI_API bool          ImParseFormatNumber(const char* format, ImGuiNumberFormat* out_nf);            // Parse simple formats e.g. "%d", "%.3f", "Value: %u ms" for use with ImFormatNumberXXX(). Return false if vsnprintf() is required.
+IMGUI_API int           ImFormatNumberInt(char* buf, size_t buf_size, const ImGuiNumberFormat* nf, ImU64 v);     // Same output as ImFormatString(buf, buf_size, format, v). Only the low 32-bits of 'v' are used unless format has "ll".
+IMGUI_API int           ImFormatNumberFloat(char* buf, size_t buf_size, const ImGuiNumberFormat* nf, double v);  // Same output as ImFormatString(buf, buf_size, format, v), or return -1 if vsnprintf() is required for this value.
+IMGUI_API int           ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, va_list args);          // Same output as ImFormatStringV() for formats using only %d %i %u %x %X %f %s %c %%, or return -1 if vsnprintf() is required.
 
 // Helpers: UTF-8 <> wchar conversions
 IMGUI_API int           ImTextCharToUtf8(char out_buf[5], unsigned int c);                                                      // return output UTF-8 bytes count
@@ -827,6 +852,54 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// [Internal] Storage chunk of ImGuiTextLog. Data[] is allocated along the chunk.
+// Only whole lines are stored, except for the last line of the last chunk which is moved to a new chunk if it doesn't fit.
+struct ImGuiTextLogChunk
+{
+    int             Size;
+    int             Capacity;
+    int             FirstLine;                              // Index of first line, counting dropped lines
+    ImVector<int>   LineOffsets;                            // Offset of each line in Data[]
+    char*           Data()                                  { return (char*)(this + 1); }
+};
+
+// Helper: ImGuiTextDirtyRange
+// Track which part of a text buffer was modified since a reference copy of it was made, so we can compare/copy only that part.
+// Text before 'Begin' and last 'TailLen' bytes of text are unchanged from the reference copy, which was 'RefLen' bytes long.
+struct ImGuiTextDirtyRange
+{
+    int             Begin;                                  // INT_MAX when unmodified
+    int             TailLen;
+    int             RefLen;                                 // -1 when the reference copy is invalid (everything is considered modified)
+
+    ImGuiTextDirtyRange()                                   { Invalidate(); }
+    void            Reset(int text_len)                     { Begin = INT_MAX; TailLen = RefLen = text_len; }
+    void            Invalidate()                            { Begin = TailLen = 0; RefLen = -1; }
+    bool            IsDirty() const                         { return Begin != INT_MAX; }
+    bool            IsValid() const                         { return RefLen >= 0; }
+    void            AddEdit(int pos, int removed_len, int text_len_before) { Begin = ImMin(Begin, pos); TailLen = ImMin(TailLen, text_len_before - pos - removed_len); }
+};
+
+// Helper: ImGuiNumberFormat
+// A format string parsed by ImParseFormatNumber(), so that ImFormatNumberInt()/ImFormatNumberFloat() can format numbers without vsnprintf().
+// Only "[prefix]%<spec>[suffix]" formats are supported, where <spec> is one of d/i/u/x/X/f with optional '-'/'0' flags, width, "ll" (integers)
+// and precision (f only), and prefix/suffix have no '%'.
+// Parse once to format many values with a same format (e.g. all cells of a table column). Decorations point into the format string, which must outlive this.
+struct ImGuiNumberFormat
+{
+    const char*     Prefix;
+    const char*     PrefixEnd;
+    const char*     Suffix;
+    const char*     SuffixEnd;
+    char            Type;           // 'd' (signed integer), 'u' (unsigned integer), 'x'/'X' (hexadecimal) or 'f' (fixed-point float)
+    char            DecimalPoint;   // Platform_LocaleDecimalPoint, to match vsnprintf() output
+    ImS8            Precision;      // Number of decimals for 'f'
+    ImS8            Width;          // Minimum width, padded with spaces or zeros
+    bool            LeftAlign;      // Has '-' flag: pad on the right
+    bool            ZeroPad;        // Has '0' flag: pad with zeros after sign
+    bool            Is64;           // Has "ll" length modifier
+};
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
 
@@ -1143,7 +1216,8 @@ enum ImGuiLogFlags_
     ImGuiLogFlags_OutputFile        = 1 << 1,
     ImGuiLogFlags_OutputBuffer      = 1 << 2,
     ImGuiLogFlags_OutputClipboard   = 1 << 3,
-    ImGuiLogFlags_OutputMask_       = ImGuiLogFlags_OutputTTY | ImGuiLogFlags_OutputFile | ImGuiLogFlags_OutputBuffer | ImGuiLogFlags_OutputClipboard,
+    ImGuiLogFlags_OutputCallback    = 1 << 4,
+    ImGuiLogFlags_OutputMask_       = ImGuiLogFlags_OutputTTY | ImGuiLogFlags_OutputFile | ImGuiLogFlags_OutputBuffer | ImGuiLogFlags_OutputClipboard | ImGuiLogFlags_OutputCallback,
 };
 
 // X/Y enums are fixed to 0/1 so they may be used to index ImVec2
@@ -1231,6 +1305,76 @@ struct IMGUI_API ImGuiInputTextDeactivatedState
 namespace ImStb { struct STB_TexteditState; }
 typedef ImStb::STB_TexteditState ImStbTexteditState;
 
+// Undo/redo step for ImGuiInputTextUndoHistory: "at Where, remove RemoveLen bytes then insert InsertLen bytes stored in data".
+// A multi-caret step (RangesCount > 0) stores RangesCount ImGuiInputTextUndoRange followed by their inserted bytes: Where/RemoveLen/InsertLen then cover all ranges.
+struct ImGuiInputTextUndoRecord
+{
+    int                     Where;
+    int                     RemoveLen;
+    int                     InsertLen;
+    int                     DataOffset;             // Offset of stored bytes in ImGuiInputTextUndoStack::Data
+    int                     DataSize;               // Size of stored bytes (== InsertLen unless Compressed or RangesCount > 0)
+    int                     RangesCount;            // 0: single range
+    bool                    Compressed;
+    bool                    Sealed;                 // Following edits can't be coalesced into this record
+};
+
+// One range of a multi-caret undo/redo step. Ranges are sorted, don't overlap, and their positions are in the text before the step is applied.
+struct ImGuiInputTextUndoRange
+{
+    int                     Where;
+    int                     RemoveLen;
+    int                     InsertLen;
+};
+
+// Stack of undo or redo records, from which oldest records can be discarded to honor a memory budget.
+// Discarded records are skipped using RecordsHead/DataHead and storage is compacted when more than half of it is unused.
+struct ImGuiInputTextUndoStack
+{
+    ImVector<ImGuiInputTextUndoRecord> Records;
+    ImVector<char>          Data;
+    int                     RecordsHead;
+    int                     DataHead;
+
+    ImGuiInputTextUndoStack()                       { RecordsHead = DataHead = 0; }
+    void                    clear()                 { Records.clear(); Data.clear(); RecordsHead = DataHead = 0; }
+    int                     GetCount() const        { return Records.Size - RecordsHead; }
+    int                     GetMemoryUsage() const  { return GetCount() * (int)sizeof(ImGuiInputTextUndoRecord) + (Data.Size - DataHead); }
+    ImGuiInputTextUndoRecord* back()                { return GetCount() > 0 ? &Records.back() : NULL; }
+};
+
+// Growable undo history used by InputText() instead of the fixed-size one of stb_textedit when io.ConfigInputTextUndoMemoryBudget > 0.
+// Consecutive edits are coalesced into a same record, and oldest records are discarded to stay within the memory budget.
+struct ImGuiInputTextUndoHistory
+{
+    ImGuiInputTextUndoStack UndoStack;
+    ImGuiInputTextUndoStack RedoStack;
+    ImVector<char>          TempBuffer;             // Temporary storage for compression/decompression and multi-caret steps
+    ImVector<ImGuiInputTextUndoRange> TempRanges;   // Temporary storage for multi-caret steps
+    int                     MemoryBudget;           // Copy of io.ConfigInputTextUndoMemoryBudget when activated. 0: disabled (use stb_textedit undo)
+    bool                    Compress;               // Copy of io.ConfigInputTextUndoCompress when activated
+    bool                    Applying;               // Set while applying an undo/redo step, so the resulting edits are not recorded
+    bool                    EnabledByMultiCaret;    // Enabled by a multi-caret edit while io.ConfigInputTextUndoMemoryBudget == 0 (stb_textedit undo can't record them)
+
+    ImGuiInputTextUndoHistory()                     { MemoryBudget = 0; Compress = Applying = EnabledByMultiCaret = false; }
+    void                    Clear()                 { UndoStack.clear(); RedoStack.clear(); }
+    void                    ClearFreeMemory()       { Clear(); TempBuffer.clear(); TempRanges.clear(); }
+    int                     GetMemoryUsage() const  { return UndoStack.GetMemoryUsage() + RedoStack.GetMemoryUsage(); }
+};
+
+// Additional caret of a multi-line InputText(). The main caret is stored in ImGuiInputTextState::Stb.
+struct ImGuiInputTextCaret
+{
+    int                     Cursor;
+    int                     SelectStart;            // SelectStart == SelectEnd when there is no selection. SelectStart may be > SelectEnd.
+    int                     SelectEnd;
+    float                   PreferredX;             // Horizontal position to keep when moving vertically, -1.0f if none
+
+    ImGuiInputTextCaret()   { Cursor = SelectStart = SelectEnd = 0; PreferredX = -1.0f; }
+    int                     GetMin() const          { return (SelectStart != SelectEnd) ? ImMin(SelectStart, SelectEnd) : Cursor; }
+    int                     GetMax() const          { return (SelectStart != SelectEnd) ? ImMax(SelectStart, SelectEnd) : Cursor; }
+};
+
 // Internal state of the currently focused/edited text input box
 // For a given item ID, access with ImGui::GetInputTextState()
 struct IMGUI_API ImGuiInputTextState
@@ -1242,8 +1386,20 @@ struct IMGUI_API ImGuiInputTextState
     int                     TextLen;                // UTF-8 length of the string in TextA (in bytes)
     const char*             TextSrc;                // == TextA.Data unless read-only, in which case == buf passed to InputText(). For _ReadOnly fields, pointer will be null outside the InputText() call.
     ImVector<char>          TextA;                  // main UTF8 buffer. TextA.Size is a buffer size! Should always be >= buf_size passed by user (and of course >= CurLenA + 1).
-    ImVector<char>          TextToRevertTo;         // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered)
-    ImVector<char>          CallbackTextBackup;     // temporary storage for callback to support automatic reconcile of undo-stack
+    ImVector<char>          TextToRevertTo;         // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered). Captured lazily on first edit, see TextToRevertToPending.
+    ImVector<char>          CallbackTextBackup;     // copy of text before calling user callback, to support automatic reconcile of undo-stack. Updated incrementally using CallbackTextBackupDirty.
+    ImGuiTextDirtyRange     CallbackTextBackupDirty;// part of TextA modified since CallbackTextBackup was updated
+    ImGuiTextDirtyRange     UserBufDirty;           // part of TextA modified since it was last copied to/from user buffer
+    ImGuiInputTextUndoHistory UndoHistory;          // undo/redo history when io.ConfigInputTextUndoMemoryBudget > 0 or after a multi-caret edit, otherwise stb_textedit's own undo state is used
+    ImVector<ImGuiInputTextCaret> ExtraCarets;      // multi-line: carets other than the main one, sorted and not overlapping. Added with Alt+Click, Ctrl+Alt+Up/Down and Alt+Shift+Drag (block selection). Each edit is applied to all carets at once.
+    ImVec2                  BlockSelectAnchor;      // multi-line: text position where Alt+Shift+Drag block selection started
+    bool                    BlockSelectActive;      // multi-line: Alt+Shift+Drag block selection in progress
+    ImVector<char>          MultiCaretBuffer;       // multi-line: temporary storage to build edits applied to all carets and text copied from all selections
+    ImGuiTextIndex          LineIndex;              // multi-line: offsets of visible lines (including word-wrapped lines), persisting while active and updated incrementally on edits
+    float                   LineIndexWrapWidth;     // multi-line: wrap width LineIndex was built with (0.0f when not word-wrapping)
+    ImFont*                 LineIndexFont;          // multi-line + word-wrap: font LineIndex was built with
+    float                   LineIndexFontSize;      // multi-line + word-wrap: font size LineIndex was built with
+    bool                    LineIndexValid;         // multi-line: LineIndex is up to date with TextA
     int                     BufCapacity;            // end-user buffer capacity (include zero terminator)
     ImVec2                  Scroll;                 // horizontal offset (managed manually) + vertical scrolling (pulled from child window's own Scroll.y)
     int                     LineCount;              // last line count (solely for debugging)
@@ -1255,14 +1411,15 @@ struct IMGUI_API ImGuiInputTextState
     bool                    EditedBefore;           // edited since activated
     bool                    EditedThisFrame;        // edited this frame
     bool                    WantReloadUserBuf;      // force a reload of user buf so it may be modified externally. may be automatic in future version.
+    bool                    TextToRevertToPending;  // TextA is unmodified since activation and TextToRevertTo has not been captured yet.
     ImS8                    LastMoveDirectionLR;    // ImGuiDir_Left or ImGuiDir_Right. track last movement direction so when cursor cross over a word-wrapping boundaries we can display it on either line depending on last move.s
     int                     ReloadSelectionStart;
     int                     ReloadSelectionEnd;
 
     ImGuiInputTextState();
     ~ImGuiInputTextState();
-    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); }
+    void        ClearText()                 { TextLen = 0; TextA[0] = 0; LineIndexValid = false; UserBufDirty.Invalidate(); CallbackTextBackupDirty.Invalidate(); CursorClamp(); }
+    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); CallbackTextBackup.clear(); CallbackTextBackupDirty.Invalidate(); LineIndex.clear(); LineIndexValid = false; UndoHistory.ClearFreeMemory(); ExtraCarets.clear(); MultiCaretBuffer.clear(); }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
     void        OnCharPressed(unsigned int c);
     float       GetPreferredOffsetX() const;
@@ -1279,6 +1436,11 @@ struct IMGUI_API ImGuiInputTextState
     void        SetSelection(int start, int end);
     void        SelectAll();
 
+    // Multiple carets (multi-line only)
+    bool        HasExtraCarets() const      { return ExtraCarets.Size > 0; }
+    void        ClearExtraCarets()          { ExtraCarets.resize(0); BlockSelectActive = false; }
+    void        AddCaret(int select_start, int select_end); // Add a caret (with optional selection) which becomes the main caret. Overlapping carets are merged.
+
     // Reload user buf (WIP #2890)
     // If you modify underlying user-passed const char* while active you need to call this (InputText V2 may lift this)
     //   strcpy(my_buf, "hello");
@@ -1289,6 +1451,57 @@ struct IMGUI_API ImGuiInputTextState
     void        ReloadUserBufAndMoveToEnd();
 };
 
+// Colored span of a line, output by ImGuiTextViewerTokenizeFunc
+struct ImGuiTextViewerSpan
+{
+    int                     Offset;                 // Offset from start of line. Text from Offset to next span (or end of line) uses this color
+    ImU32                   Col;                    // 0: use ImGuiCol_Text
+};
+
+// Tokenizer for TextViewer(): output spans of [line_begin, line_end) in order of increasing Offset, and return the state to pass to the next line
+// ('state' is 0 for the first line). Use the state for constructs spanning multiple lines (e.g. block comments), or always return 0.
+// 'out_spans' is NULL when only the returned state is needed (e.g. catching up on lines which are not visible).
+typedef int (*ImGuiTextViewerTokenizeFunc)(void* user_data, const char* line_begin, const char* line_end, int state, ImVector<ImGuiTextViewerSpan>* out_spans);
+
+// Cached tokenization of a line displayed by TextViewer()
+struct ImGuiTextViewerLine
+{
+    int                     LineNo;                 // -1 when unused
+    int                     LineEndOffset;          // Detect text appended to the last line
+    int                     StateIn;                // State the line was tokenized with
+    int                     Generation;             // == ImGuiTextViewer::Generation when valid
+    float                   Width;
+    ImVector<ImGuiTextViewerSpan> Spans;            // Sorted, first span at offset 0
+    ImVector<float>         SpansX;                 // Horizontal offset of each span
+
+    ImGuiTextViewerLine()   { LineNo = -1; LineEndOffset = StateIn = Generation = 0; Width = 0.0f; }
+};
+
+// Storage for TextViewer(): read-only view of a large text buffer you own (e.g. an append-only log), with colors provided by a tokenizer.
+// - Lines are indexed incrementally: text appended to the buffer since last frame is the only text scanned. Call Invalidate() if you modify older text.
+// - End state of the tokenizer is stored for each line. Lines are tokenized in order, up to MaxTokenizeBytesPerFrame per frame, so jumping to the end
+//   of a large buffer doesn't stall: lines whose previous state is not known yet are displayed tokenized with state 0 until catching up.
+// - Spans are only cached for lines recently displayed, so memory usage is 4 bytes per line + text visible on screen.
+struct IMGUI_API ImGuiTextViewer
+{
+    ImGuiTextIndex          LineIndex;
+    ImVector<int>           LineStates;             // Tokenizer state at the end of each line, for lines [0, LineStates.Size)
+    ImVector<ImGuiTextViewerLine> LinesCache;       // Direct-mapped on line number, size is a power of two
+    ImGuiTextViewerTokenizeFunc TokenizeFunc;       // = NULL       // Optional tokenizer. Call Invalidate(0) if you change it.
+    void*                   TokenizeUserData;       // = NULL
+    int                     MaxTokenizeBytesPerFrame; // = 1 MB     // Amount of text tokenized per frame to catch up on end states of lines not yet visited. <= 0 to tokenize everything in one frame.
+    bool                    AutoScroll;             // = true       // Keep scrolling to the bottom when new lines are appended, if already at the bottom.
+    int                     Generation;             // Incremented to invalidate LinesCache
+    float                   MaxLineWidth;           // Largest width of lines displayed so far, to size horizontal scrolling
+    ImFont*                 Font;                   // Font and size used to measure cached lines
+    float                   FontSize;
+
+    ImGuiTextViewer();
+    ~ImGuiTextViewer()      { LinesCache.clear_destruct(); }
+    void                    Clear();                // Clear index and caches, e.g. after clearing your buffer (this is also done automatically when the buffer shrinks)
+    void                    Invalidate(int text_offset); // Text at and after 'text_offset' was modified: index and tokenize it again
+};
+
 enum ImGuiWindowRefreshFlags_
 {
     ImGuiWindowRefreshFlags_None                = 0,
@@ -1678,10 +1891,12 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             MeasureItemIdx;     // When using ImGuiListClipperHeights: item being submitted, measured on next step
+    float                           MeasureStartPosY;   // "
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset((void*)this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; MeasureItemIdx = -1; MeasureStartPosY = 0.0f; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1996,6 +2211,25 @@ struct ImGuiViewportP : public ImGuiViewport
     ImRect  GetBuildWorkRect() const    { ImVec2 pos = CalcWorkRectPos(BuildWorkInsetMin); ImVec2 size = CalcWorkRectSize(BuildWorkInsetMin, BuildWorkInsetMax); return ImRect(pos.x, pos.y, pos.x + size.x, pos.y + size.y); }
 };
 
+// Uniform grid of windows covering the main viewport, used to accelerate FindHoveredWindowEx() when there are many windows.
+// - Windows register their padded OuterRectClipped from Begin(). Cells are only touched when the range of cells covered changes.
+// - Windows which are not active anymore are removed in NewFrame().
+// - Cells are unordered: queries compare ImGuiWindow::DisplayIndex to find the front-most window.
+#ifndef IMGUI_WINDOW_HIT_GRID_CELLS
+#define IMGUI_WINDOW_HIT_GRID_CELLS         16          // Number of cells on each axis
+#endif
+
+struct ImGuiWindowHitGrid
+{
+    ImRect                  Bounds;                     // Area covered by the grid (main viewport rectangle). Queries outside of it fall back to a linear search.
+    ImVec2                  CellSize;
+    float                   Padding;                    // Padding applied to registered rectangles: max of TouchExtraPadding and WindowBorderHoverPadding.
+    int                     WindowsCount;               // Number of windows currently registered
+    ImVector<ImGuiWindow*>  Cells[IMGUI_WINDOW_HIT_GRID_CELLS * IMGUI_WINDOW_HIT_GRID_CELLS];
+
+    ImGuiWindowHitGrid()    { CellSize = ImVec2(0.0f, 0.0f); Padding = 0.0f; WindowsCount = 0; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Settings support
 //-----------------------------------------------------------------------------
@@ -2111,12 +2345,26 @@ struct ImGuiDebugAllocEntry
     ImS16       FreeCount;
 };
 
+// Call site of an allocation which happened in a steady-state frame (see io.ConfigDebugAllocSteadyStateFrames)
+struct ImGuiDebugAllocCallSite
+{
+    int         FrameCount;
+    size_t      Size;
+    ImGuiID     WindowID;                   // Current window when allocating
+    ImGuiID     ItemID;                     // Last item submitted in current window
+    void*       ReturnAddress;              // Caller of MemAlloc(), if supported by compiler (see IM_RETURN_ADDRESS)
+};
+
 struct ImGuiDebugAllocInfo
 {
     int         TotalAllocCount;            // Number of call to MemAlloc().
     int         TotalFreeCount;
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
+    bool        SteadyState;                // Set when current frame was preceded by io.ConfigDebugAllocSteadyStateFrames allocation-free frames
+    int         SteadyStateFrames;          // Number of consecutive allocation-free frames
+    int         SteadyStateAllocsCount;     // Total number of allocations reported in steady-state frames
+    ImGuiDebugAllocCallSite SteadyStateAllocsBuf[8]; // Track last 8 allocations reported in steady-state frames
 
     ImGuiDebugAllocInfo() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -2174,6 +2422,81 @@ struct ImGuiIDStackTool
     ImGuiIDStackTool()      { memset((void*)this, 0, sizeof(*this)); LastActiveFrame = -1; OptHexEncodeNonAsciiChars = true; CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Profiler support
+//-----------------------------------------------------------------------------
+// Enable with '#define IMGUI_ENABLE_PROFILER' in imconfig.h.
+// - IMGUI_PROFILER_ZONE("Name") records the CPU time spent in the current C++ scope. Name must be a literal/persistent string.
+// - Zones are recorded into a per-context ring buffer (g.Profiler.Records) and aggregated per frame (g.Profiler.Zones).
+// - Use ImGui::ProfilerSetHooks() to forward zones to an external profiler.
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+#ifndef IMGUI_PROFILER_RECORDS_CAPACITY
+#define IMGUI_PROFILER_RECORDS_CAPACITY     4096
+#endif
+
+typedef void (*ImGuiProfilerZoneHookFn)(ImGuiContext* ctx, const char* name, void* user_data);
+
+// Storage for one recorded zone instance
+struct ImGuiProfilerRecord
+{
+    const char*             Name;
+    ImU64                   TimeBegin;                  // In nanoseconds
+    ImU64                   TimeEnd;                    // 0 while zone is in progress
+    int                     FrameCount;
+    int                     Depth;                      // Nesting depth of the zone
+};
+
+// Per-zone timings, aggregated over a frame
+struct ImGuiProfilerZoneStats
+{
+    const char*             Name;
+    int                     NestingDepth;               // Nested instances of a same zone (e.g. Begin() for child windows) are accounted for once
+    int                     CallsThisFrame;
+    int                     CallsLastFrame;
+    ImU64                   TimeThisFrame;              // In nanoseconds
+    ImU64                   TimeLastFrame;
+    float                   TimeAvgMs;                  // Exponential moving average over last frames
+    float                   TimeMaxMs;                  // Max since last reset
+
+    ImGuiProfilerZoneStats() { memset((void*)this, 0, sizeof(*this)); }
+};
+
+struct ImGuiProfiler
+{
+    bool                    Paused;                     // Stop recording and aggregating zones (external hooks are still called)
+    int                     Depth;                      // Current nesting depth
+    int                     RecordsNext;                // Write index in Records[] ring buffer
+    int                     RecordsCount;               // Number of valid records in Records[] (saturates at ring buffer size)
+    ImVector<ImGuiProfilerRecord>    Records;           // Ring buffer of last IMGUI_PROFILER_RECORDS_CAPACITY zones
+    ImVector<ImGuiProfilerZoneStats> Zones;             // Aggregated timings per zone name
+    ImGuiProfilerZoneHookFn HookZoneBegin;              // Optional hooks to forward zones to an external profiler
+    ImGuiProfilerZoneHookFn HookZoneEnd;
+    void*                   HookUserData;
+
+    ImGuiProfiler()         { Paused = false; Depth = RecordsNext = RecordsCount = 0; HookZoneBegin = HookZoneEnd = NULL; HookUserData = NULL; }
+};
+
+// Helper to record a zone over a C++ scope (use IMGUI_PROFILER_ZONE macro)
+struct ImGuiProfilerScope
+{
+    ImGuiContext*           Ctx;
+    const char*             Name;
+    ImU64                   TimeBegin;
+    int                     RecordIdx;                  // Index in Records[], -1 when not recording
+    int                     ZoneIdx;                    // Index in Zones[], -1 when not recording
+
+    ImGuiProfilerScope(const char* name);
+    ~ImGuiProfilerScope();
+};
+
+#define IMGUI_PROFILER_ZONE(_NAME)          ImGuiProfilerScope imgui_profiler_zone(_NAME)
+#else
+#define IMGUI_PROFILER_ZONE(_NAME)          do { } while (0)
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -2234,6 +2557,7 @@ struct ImGuiContext
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
+    ImGuiWindowHitGrid      WindowsHitGrid;                     // Spatial index of windows, for hovered window lookup.
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
@@ -2536,7 +2860,9 @@ struct ImGuiContext
     ImGuiLogFlags           LogFlags;                           // Capture flags/type
     ImGuiWindow*            LogWindow;
     ImFileHandle            LogFile;                            // If != NULL log to stdout/ file
-    ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard. This is pointer so our GImGui static constructor doesn't call heap allocators.
+    ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard/buffer, or batch when log to file/callback. This is pointer so our GImGui static constructor doesn't call heap allocators.
+    ImGuiLogCallback        LogCallback;                        // If != NULL log to callback
+    void*                   LogCallbackUserData;
     const char*             LogNextPrefix;                      // See comment in LogSetNextTextDecoration(): doesn't copy underlying data, use carefully!
     const char*             LogNextSuffix;
     float                   LogLinePosY;
@@ -2575,6 +2901,9 @@ struct ImGuiContext
     ImGuiDebugItemPathQuery DebugItemPathQuery;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
 #if defined(IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS) && !defined(IMGUI_DISABLE_DEBUG_TOOLS)
     ImGuiStorage            DebugDrawIdConflictsAliveCount;
     ImGuiStorage            DebugDrawIdConflictsHighlightSet;
@@ -2711,6 +3040,9 @@ struct IMGUI_API ImGuiWindow
     short                   BeginOrderWithinParent;             // Begin() order within immediate parent window, if we are a child window. Otherwise 0.
     short                   BeginOrderWithinContext;            // Begin() order within entire imgui context. This is mostly used for debugging submission order related issues.
     short                   FocusOrder;                         // Order within WindowsFocusOrder[], altered when windows are focused.
+    int                     DisplayIndex;                       // Index within g.Windows[]. Cached: maintained by EndFrame() and BringWindowToDisplayXXX() functions, always access via FindWindowDisplayIndex().
+    ImVec2ih                HitGridCellMin;                     // Range of cells covered in g.WindowsHitGrid. HitGridCellMin.x == -1 when not registered.
+    ImVec2ih                HitGridCellMax;                     // "
     ImGuiDir                AutoPosLastDirection;
     ImS8                    AutoFitFramesX, AutoFitFramesY;
     bool                    AutoFitOnlyGrows;
@@ -2879,6 +3211,7 @@ struct IMGUI_API ImGuiTabBar
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
 #define IMGUI_TABLE_MAX_COLUMNS         512                 // Arbitrary "safety" maximum, may be lifted in the future if needed. Must fit in ImGuiTableColumnIdx/ImGuiTableDrawChannelIdx.
+#define IMGUI_TABLE_MAX_COLUMNS_VIRTUALIZED 16384           // Maximum when using ImGuiTableFlags_Virtualized. Must fit in ImGuiTableColumnIdx, and (columns * 2 + 4) must fit in ImGuiTableDrawChannelIdx.
 
 // [Internal] sizeof() ~ 112
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
@@ -2904,7 +3237,7 @@ struct ImGuiTableColumn
     float                   ContentMaxXUnfrozen;
     float                   ContentMaxXHeadersUsed;         // Contents maximum position for headers rows (regardless of freezing). TableHeader() automatically softclip itself + report ideal desired size, to avoid creating extraneous draw calls
     float                   ContentMaxXHeadersIdeal;
-    ImS16                   NameOffset;                     // Offset into parent ColumnsNames[]
+    int                     NameOffset;                     // Offset into parent ColumnsNames[]
     ImGuiTableColumnIdx     DisplayOrder;                   // Index within Table's IndexToDisplayOrder[] (column may be reordered by users)
     ImGuiTableColumnIdx     IndexWithinEnabledSet;          // Index within enabled/visible set (<= IndexToDisplayOrder)
     ImGuiTableColumnIdx     PrevEnabledColumn;              // Index of prev enabled/visible column within Columns[], -1 if first enabled/visible column
@@ -2961,6 +3294,44 @@ struct ImGuiTableHeaderData
     ImU32                       BgColor1;
 };
 
+// Draw output of one cell recorded by TableNextRowCached()
+struct ImGuiTableRowCacheCell
+{
+    ImVec2                      StartPos;                   // Cursor position at the beginning of the cell when recorded. Vertices are translated by the difference when replayed.
+    ImVec2                      CursorMaxPos;               // window->DC.CursorMaxPos at the end of the cell, relative to StartPos
+    float                       PrevLineTextBaseOffset;
+    int                         VtxCount;
+    int                         IdxCount;
+    ImGuiTableColumnIdx         Column;
+};
+
+// Row recorded by TableNextRowCached(), replayed while its version is unchanged.
+// Vertices and indices (relative to first vertex) of all cells are stored back to back, in cells submission order.
+struct ImGuiTableRowCache
+{
+    ImGuiID                     RowId;
+    ImGuiID                     Key;                        // Key in table->RowsCacheMap (hash of RowId and instance)
+    ImU64                       Version;
+    int                         InstanceNo;
+    int                         LastFrameUsed;
+    ImGuiID                     LayoutHash;                 // Table->RowsCacheLayoutHash when recorded
+    float                       Height;
+    float                       Alpha;                      // g.Style.Alpha when recorded (e.g. BeginDisabled() around some rows)
+    int                         ColorStackSize;             // g.ColorStack.Size when recorded (e.g. PushStyleColor() around some rows)
+    int                         StyleVarStackSize;          // g.StyleVarStack.Size when recorded
+    ImFont*                     Font;
+    float                       FontSize;
+    ImTextureRef                TexRef;
+    bool                        IsValid;                    // Set when recording completed and may be replayed
+    ImU32                       RowBgColor[2];
+    ImVector<ImGuiTableCellData>        CellsBgColor;
+    ImVector<ImGuiTableRowCacheCell>    Cells;
+    ImVector<ImDrawVert>        VtxBuffer;
+    ImVector<ImDrawIdx>         IdxBuffer;
+
+    ImGuiTableRowCache()        { RowId = Key = 0; Version = 0; InstanceNo = LastFrameUsed = -1; LayoutHash = 0; ColorStackSize = StyleVarStackSize = 0; Height = Alpha = FontSize = 0.0f; Font = NULL; IsValid = false; RowBgColor[0] = RowBgColor[1] = IM_COL32_DISABLE; }
+};
+
 // Per-instance data that needs preserving across frames (seemingly most others do not need to be preserved aside from debug needs. Does that means they could be moved to ImGuiTableTempData?)
 // sizeof() ~ 24 bytes
 struct ImGuiTableInstanceData
@@ -3020,6 +3391,10 @@ struct IMGUI_API ImGuiTable
     float                       ColumnsGivenWidth;          // Sum of current column width
     float                       ColumnsAutoFitWidth;        // Sum of ideal column width in order nothing to be clipped, used for auto-fitting and content width submission in outer window
     float                       ColumnsStretchSumWeights;   // Sum of weight of all enabled stretching columns
+    float                       LayoutCacheWidthAvail;      // Inputs of the last columns widths computation in TableUpdateLayout(), compared every frame to reuse its results (see IsLayoutCacheValid)
+    float                       LayoutCacheWidthSpacings;
+    float                       LayoutCacheCellPaddingX;
+    ImGuiTableFlags             LayoutCacheFlags;
     float                       ResizedColumnNextWidth;
     float                       ResizeLockMinContentsX2;    // Lock minimum contents width while resizing down in order to not create feedback loops. But we allow growing the table.
     float                       RefScale;                   // Reference scale to be able to rescale columns on font/dpi changes.
@@ -3046,6 +3421,7 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns using fixed width (<= ColumnsCount)
+    ImGuiTableColumnIdx         ColumnsVisibleCount;        // Number of visible columns (<= ColumnsEnabledCount), aka set bits in VisibleMaskByIndex
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
     ImGuiTableColumnIdx         AngledHeadersCount;         // Count columns with angled headers
     ImGuiTableColumnIdx         HoveredColumnBody;          // Index of column whose visible region is being hovered. Important: == ColumnsCount when hovering empty region after the right-most column!
@@ -3081,6 +3457,7 @@ struct IMGUI_API ImGuiTable
     bool                        DisableDefaultContextMenu;  // Disable default context menu. You may submit your own using TableBeginContextMenuPopup()/EndPopup()
     bool                        IsSettingsRequestLoad;
     bool                        IsSettingsDirty;            // Set when table settings have changed and needs to be reported into ImGuiTableSettings data.
+    bool                        IsLayoutCacheValid;         // Set when columns widths computed by TableUpdateLayout() may be reused on the next frame. Cleared when columns flags/sizes/settings are changed.
     bool                        IsDefaultDisplayOrder;      // Set when display order is unchanged from default (DisplayOrder contains 0...Count-1)
     bool                        IsResetAllRequest;
     bool                        IsResetDisplayOrderRequest;
@@ -3093,8 +3470,19 @@ struct IMGUI_API ImGuiTable
     bool                        MemoryCompacted;
     bool                        HostSkipItems;              // Backup of InnerWindow->SkipItem at the end of BeginTable(), because we will overwrite InnerWindow->SkipItem on a per-column basis
 
-    ImGuiTable()                { memset((void*)this, 0, sizeof(*this)); LastFrameActive = -1; }
-    ~ImGuiTable()               { IM_FREE(RawData); }
+    // Rows cache (see TableNextRowCached())
+    ImVector<ImGuiTableRowCache> RowsCache;
+    ImGuiStorage                RowsCacheMap;               // Hash of row id and instance -> index in RowsCache[]
+    ImGuiStorage                RowsCacheMapPending;        // Keys added since last frame, not sorted yet. Merged into RowsCacheMap by TableRowsCacheUpdateFrame().
+    ImGuiID                     RowsCacheContextHash;       // Hash of style and font atlas state baked in recorded vertices. All rows are invalidated when it changes.
+    ImGuiID                     RowsCacheLayoutHash;        // Hash of visible columns and their widths for current frame
+    int                         RowsCacheFrame;             // Frame when RowsCacheContextHash/RowsCacheLayoutHash/RowsCacheBlocked were updated
+    int                         RowsCacheRecordIdx;         // Index in RowsCache[] of row being recorded, or -1
+    int                         RowsCacheFreeSearchIdx;     // Entries of RowsCache[] before this index are known to be in use for current frame (reset every frame)
+    bool                        RowsCacheBlocked;           // Interacting with the table: rows are neither replayed nor recorded for the current frame
+
+    ImGuiTable()                { memset((void*)this, 0, sizeof(*this)); LastFrameActive = -1; RowsCacheFrame = -1; RowsCacheRecordIdx = -1; }
+    ~ImGuiTable()               { IM_FREE(RawData); RowsCache.clear_destruct(); }
 };
 
 // Transient data that are only needed between BeginTable() and EndTable(), those buffers are shared (1 per level of stacked table).
@@ -3109,6 +3497,14 @@ struct IMGUI_API ImGuiTableTempData
     float                       LastTimeActive;             // Last timestamp this structure was used
     float                       AngledHeadersExtraWidth;    // Used in EndTable()
     ImVector<ImGuiTableHeaderData> AngledHeadersRequests;   // Used in TableAngledHeadersRow()
+    ImVector<ImGuiTableColumnIdx> VirtualColumns;           // Used in TableVirtualCells(): columns to submit, in display order
+    int                         RowsCacheCellVtxStart;      // Used in TableNextRowCached() recording: state of the draw list at the beginning of the current cell
+    int                         RowsCacheCellIdxStart;
+    int                         RowsCacheCellCmdCount;
+    unsigned int                RowsCacheCellVtxCurrentIdx;
+    int                         RowsCacheCellChannel;
+    int                         RowsCacheWindowsActiveCount;
+    ImVec2                      RowsCacheClipRangeY;        // Vertical range of the clipping rectangle of the recorded row (must fit entirely)
 
     ImVec2                      UserOuterSize;              // outer_size.x passed to BeginTable()
     ImDrawListSplitter          DrawSplitter;
@@ -3325,6 +3721,7 @@ namespace ImGui
     // Logging/Capture
     IMGUI_API void          LogBegin(ImGuiLogFlags flags, int auto_open_depth);         // -> BeginCapture() when we design v2 api, for now stay under the radar by using the old name.
     IMGUI_API void          LogToBuffer(int auto_open_depth = -1);                      // Start logging/capturing to internal buffer
+    IMGUI_API void          LogFlushBatch();                                            // Write text accumulated when logging to file/callback. Called at the end of each frame.
     IMGUI_API void          LogRenderedText(const ImVec2* ref_pos, const char* text, const char* text_end = NULL);
     IMGUI_API void          LogSetNextTextDecoration(const char* prefix, const char* suffix);
 
@@ -3566,8 +3963,15 @@ namespace ImGui
     IMGUI_API float         TableGetColumnWidthAuto(ImGuiTable* table, ImGuiTableColumn* column);
     IMGUI_API void          TableBeginRow(ImGuiTable* table);
     IMGUI_API void          TableEndRow(ImGuiTable* table);
+    IMGUI_API void          TableRowsCacheUpdateFrame(ImGuiTable* table);
+    IMGUI_API void          TableRowsCacheBeginCell(ImGuiTable* table);
+    IMGUI_API void          TableRowsCacheEndCell(ImGuiTable* table);
+    IMGUI_API void          TableRowsCacheEndRow(ImGuiTable* table);
+    IMGUI_API void          TableRowsCacheReplay(ImGuiTable* table, ImGuiTableRowCache* row_cache);
     IMGUI_API void          TableBeginCell(ImGuiTable* table, int column_n);
     IMGUI_API void          TableEndCell(ImGuiTable* table);
+    IMGUI_API void          TableVirtualCellsEx(ImGuiTable* table, int rows_count, ImGuiTableCellCallback cell_func, void* user_data, float row_height, int* out_visible_start = NULL, int* out_visible_end = NULL);
+    IMGUI_API void          TableDataSourceCell(void* user_data, int row_n, int column_n);
     IMGUI_API ImRect        TableGetCellBgRect(const ImGuiTable* table, int column_n);
     IMGUI_API const char*   TableGetColumnName(const ImGuiTable* table, int column_n);
     IMGUI_API ImGuiID       TableGetColumnResizeID(ImGuiTable* table, int column_n, int instance_no = 0);
@@ -3646,6 +4050,7 @@ namespace ImGui
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
     IMGUI_API void          TextAligned(float align_x, float size_x, const char* fmt, ...);               // FIXME-WIP: Works but API is likely to be reworked. This is designed for 1 item on the line. (#7024)
     IMGUI_API void          TextAlignedV(float align_x, float size_x, const char* fmt, va_list args);
+    IMGUI_API void          TextViewer(const char* str_id, ImGuiTextViewer* viewer, const char* text, const char* text_end, const ImVec2& size_arg = ImVec2(0, 0), ImGuiChildFlags child_flags = 0); // Child window displaying a large read-only text with colors from viewer->TokenizeFunc. Pass 'text_end' to avoid a strlen().
 
     // Widgets
     IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
@@ -3676,6 +4081,7 @@ namespace ImGui
     // Widgets: Tree Nodes
     IMGUI_API bool          TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* label, const char* label_end = NULL);
     IMGUI_API void          TreeNodeDrawLineToChildNode(const ImVec2& target_pos);
+    IMGUI_API float         TreeNodeDrawLineToChildNodeEx(float x1, const ImVec2& target_pos);
     IMGUI_API void          TreeNodeDrawLineToTreePop(const ImGuiTreeNodeStackData* data);
     IMGUI_API void          TreePushOverrideID(ImGuiID id);
     IMGUI_API void          TreeNodeSetOpen(ImGuiID storage_id, bool open);
@@ -3742,8 +4148,20 @@ namespace ImGui
     // Demo Doc Marker for e.g. imgui_explorer
     IMGUI_API void          DemoMarker(const char* file, int line, const char* section);
 
+    // Profiler (when IMGUI_ENABLE_PROFILER is defined)
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API ImU64         ProfilerGetTime();                                      // In nanoseconds, monotonic
+    IMGUI_API void          ProfilerNewFrame(ImGuiContext* ctx);
+    IMGUI_API void          ProfilerZoneBegin(ImGuiProfilerScope* scope);
+    IMGUI_API void          ProfilerZoneEnd(ImGuiProfilerScope* scope);
+    IMGUI_API void          ProfilerSetHooks(ImGuiProfilerZoneHookFn zone_begin, ImGuiProfilerZoneHookFn zone_end, void* user_data);
+    IMGUI_API const ImGuiProfilerZoneStats* ProfilerFindZoneStats(const char* name);
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
+
     // Debug Tools
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+    IMGUI_API void          DebugAllocReportSteadyState(ImGuiContext* ctx, size_t size, void* return_address);
     IMGUI_API void          DebugDrawCursorPos(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawLineExtents(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawItemRect(ImU32 col = IM_COL32(255, 0, 0, 255));
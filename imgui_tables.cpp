@@ -324,7 +324,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         return false;
 
     // Sanity checks
-    IM_ASSERT(columns_count > 0 && columns_count < IMGUI_TABLE_MAX_COLUMNS);
+    IM_ASSERT(columns_count > 0 && columns_count < ((flags & ImGuiTableFlags_Virtualized) ? IMGUI_TABLE_MAX_COLUMNS_VIRTUALIZED : IMGUI_TABLE_MAX_COLUMNS));
     if (flags & ImGuiTableFlags_ScrollX)
         IM_ASSERT(inner_width >= 0.0f);
 
@@ -627,6 +627,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         //IMGUI_DEBUG_PRINT("[table] %08X RefScaleUnit %.3f -> %.3f, scaling width by %.3f\n", table->ID, table->RefScaleUnit, new_ref_scale_unit, scale_factor);
         for (int n = 0; n < columns_count; n++)
             table->Columns[n].WidthRequest = table->Columns[n].WidthRequest * scale_factor;
+        table->IsLayoutCacheValid = false;
     }
     table->RefScale = new_ref_scale_unit;
 
@@ -823,6 +824,8 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
     //IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiTableColumnFlags_AlignMask_)); // Check that only 1 of each set is used.
 
     // Preserve status flags
+    if ((column->Flags & ~(ImGuiTableColumnFlags_StatusMask_ | ImGuiTableColumnFlags_NoDirectResize_)) != flags)
+        table->IsLayoutCacheValid = false;
     column->Flags = flags | (column->Flags & ImGuiTableColumnFlags_StatusMask_);
 
     // Build an ordered list of available sort directions
@@ -849,6 +852,7 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
 void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("TableUpdateLayout");
     IM_ASSERT(table->IsLayoutLocked == false);
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
@@ -857,15 +861,22 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     ImBitArrayClearAllBits(table->EnabledMaskByIndex, table->ColumnsCount);
     ImBitArrayClearAllBits(table->EnabledMaskByDisplayOrder, table->ColumnsCount);
     table->LeftMostEnabledColumn = -1;
-    table->MinColumnWidth = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
+    const float min_column_width = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
+    if (table->MinColumnWidth != min_column_width)
+        table->IsLayoutCacheValid = false;
+    table->MinColumnWidth = min_column_width;
 
     // [Part 1] Apply/lock Enabled and Order states. Calculate auto/ideal width for columns. Count fixed/stretch columns.
     // Process columns in their visible orders as we are building the Prev/Next indices.
+    // We also check whether widths computed on a previous frame may be reused (see below). Changes of flags/init widths are detected in
+    // TableSetupColumn(), changes of sizes/order/visibility always set IsSettingsDirty. The remaining input is contents width.
     int count_fixed = 0;                // Number of columns that have fixed sizing policies
     int count_stretch = 0;              // Number of columns that have stretch sizing policies
     int prev_visible_column_idx = -1;
     bool has_auto_fit_request = false;
     bool has_resizable = false;
+    bool layout_cache_hit = table->IsLayoutCacheValid;  // Reuse widths computed on a previous frame
+    bool layout_cache_store = true;                     // Allow reusing widths computed on this frame
     float stretch_sum_width_auto = 0.0f;
     float fixed_max_width_auto = 0.0f;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
@@ -883,6 +894,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             TableSetupColumnFlags(table, column, ImGuiTableColumnFlags_None);
             column->NameOffset = -1;
             column->UserID = 0;
+            if (column->InitStretchWeightOrWidth != -1.0f)
+                table->IsLayoutCacheValid = layout_cache_hit = false;
             column->InitStretchWeightOrWidth = -1.0f;
         }
 
@@ -927,6 +940,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 
         // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
         // Combine width from regular rows + width from headers unless requested not to.
+        const float width_auto_prev = column->WidthAuto;
         if (!column->IsPreserveWidthAuto && table->InstanceCurrent == 0)
             column->WidthAuto = TableGetColumnWidthAuto(table, column);
 
@@ -936,6 +950,10 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             has_resizable = true;
         if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && column->InitStretchWeightOrWidth > 0.0f && !column_is_resizable)
             column->WidthAuto = column->InitStretchWeightOrWidth;
+        if (column->WidthAuto != width_auto_prev || column->IsPreserveWidthAuto)
+            layout_cache_hit = false;
+        if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && !column->IsRequestOutput)
+            layout_cache_hit = layout_cache_store = false; // Part 3 doesn't update WidthRequest of clipped auto-resizing columns
 
         if (column->AutoFitQueue != 0x00)
             has_auto_fit_request = true;
@@ -963,113 +981,134 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     if (has_auto_fit_request)
         table->IsSettingsDirty = true;
 
-    // [Part 3] Fix column flags and record a few extra information.
-    float sum_width_requests = 0.0f;    // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
-    float stretch_sum_weights = 0.0f;   // Sum of all weights for stretch columns.
-    table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-    {
-        if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
-            continue;
-        ImGuiTableColumn* column = &table->Columns[column_n];
-
-        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
-        if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
-        {
-            // Apply same widths policy
-            float width_auto = column->WidthAuto;
-            if (table_sizing_policy == ImGuiTableFlags_SizingFixedSame && (column->AutoFitQueue != 0x00 || !column_is_resizable))
-                width_auto = fixed_max_width_auto;
-
-            // Apply automatic width
-            // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
-            if (column->AutoFitQueue != 0x00)
-                column->WidthRequest = width_auto;
-            else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && column->IsRequestOutput)
-                column->WidthRequest = width_auto;
-
-            // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
-            // (e.g. TextWrapped) too much. Otherwise what tends to happen is that TextWrapped would output a very
-            // large height (= first frame scrollbar display very off + clipper would skip lots of items).
-            // This is merely making the side-effect less extreme, but doesn't properly fixes it.
-            // FIXME: Move this to ->WidthGiven to avoid temporary lossyness?
-            // FIXME: This break IsPreserveWidthAuto from not flickering if the stored WidthAuto was smaller.
-            if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
-                column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
-            sum_width_requests += column->WidthRequest;
-        }
-        else
-        {
-            // Initialize stretch weight
-            if (column->AutoFitQueue != 0x00 || column->StretchWeight < 0.0f || !column_is_resizable)
-            {
-                if (column->InitStretchWeightOrWidth > 0.0f)
-                    column->StretchWeight = column->InitStretchWeightOrWidth;
-                else if (table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
-                    column->StretchWeight = (column->WidthAuto / stretch_sum_width_auto) * count_stretch;
-                else
-                    column->StretchWeight = 1.0f;
-            }
-
-            stretch_sum_weights += column->StretchWeight;
-            if (table->LeftMostStretchedColumn == -1 || table->Columns[table->LeftMostStretchedColumn].DisplayOrder > column->DisplayOrder)
-                table->LeftMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
-            if (table->RightMostStretchedColumn == -1 || table->Columns[table->RightMostStretchedColumn].DisplayOrder < column->DisplayOrder)
-                table->RightMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
-        }
-        column->IsPreserveWidthAuto = false;
-        sum_width_requests += table->CellPaddingX * 2.0f;
-    }
-    table->ColumnsEnabledFixedCount = (ImGuiTableColumnIdx)count_fixed;
-    table->ColumnsStretchSumWeights = stretch_sum_weights;
-
-    // [Part 4] Apply final widths based on requested widths
+    // Reuse widths computed on a previous frame when nothing affecting them changed.
+    // This is common for e.g. dashboards with many small tables: Part 3, 4 and 5 can be skipped entirely, while Part 6 still runs
+    // every frame since it depends on positions, clipping and hovering. (The results of Part 3/4/5 are stored in the columns and
+    // only modified by functions which invalidate the cache, e.g. TableSetColumnWidth() or TableLoadSettings())
     const ImRect work_rect = table->WorkRect;
     const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
     const float width_removed = (table->HasScrollbarYPrev && !table->InnerWindow->ScrollbarY) ? g.Style.ScrollbarSize : 0.0f; // To synchronize decoration width of synced tables with mismatching scrollbar state (#5920)
     const float width_avail = ImMax(1.0f, (((table->Flags & ImGuiTableFlags_ScrollX) && table->InnerWidth == 0.0f) ? table->InnerClipRect.GetWidth() : work_rect.GetWidth()) - width_removed);
-    const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
-    float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
-    table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    if (table->IsSettingsDirty || table->LayoutCacheFlags != table->Flags || table->LayoutCacheWidthAvail != width_avail || table->LayoutCacheWidthSpacings != width_spacings || table->LayoutCacheCellPaddingX != table->CellPaddingX)
+        layout_cache_hit = false;
+    if (layout_cache_hit)
     {
-        if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
-            continue;
-        ImGuiTableColumn* column = &table->Columns[column_n];
-
-        // Allocate width for stretched/weighted columns (StretchWeight gets converted into WidthRequest)
-        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+        // Restore flag cleared by TableSetupColumnFlags(), see [Resize Rule 1] below.
+        if (table->LeftMostStretchedColumn != -1)
+            table->Columns[table->RightMostEnabledColumn].Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+    }
+    else
+    {
+        // [Part 3] Fix column flags and record a few extra information.
+        float sum_width_requests = 0.0f;    // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
+        float stretch_sum_weights = 0.0f;   // Sum of all weights for stretch columns.
+        table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         {
-            float weight_ratio = column->StretchWeight / stretch_sum_weights;
-            column->WidthRequest = IM_TRUNC(ImMax(width_avail_for_stretched_columns * weight_ratio, table->MinColumnWidth) + 0.01f);
-            width_remaining_for_stretched_columns -= column->WidthRequest;
-        }
+            if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
+                continue;
+            ImGuiTableColumn* column = &table->Columns[column_n];
 
-        // [Resize Rule 1] The right-most Visible column is not resizable if there is at least one Stretch column
-        // See additional comments in TableSetColumnWidth().
-        if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
-            column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+            const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
+            if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
+            {
+                // Apply same widths policy
+                float width_auto = column->WidthAuto;
+                if (table_sizing_policy == ImGuiTableFlags_SizingFixedSame && (column->AutoFitQueue != 0x00 || !column_is_resizable))
+                    width_auto = fixed_max_width_auto;
+
+                // Apply automatic width
+                // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
+                if (column->AutoFitQueue != 0x00)
+                    column->WidthRequest = width_auto;
+                else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && column->IsRequestOutput)
+                    column->WidthRequest = width_auto;
+
+                // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
+                // (e.g. TextWrapped) too much. Otherwise what tends to happen is that TextWrapped would output a very
+                // large height (= first frame scrollbar display very off + clipper would skip lots of items).
+                // This is merely making the side-effect less extreme, but doesn't properly fixes it.
+                // FIXME: Move this to ->WidthGiven to avoid temporary lossyness?
+                // FIXME: This break IsPreserveWidthAuto from not flickering if the stored WidthAuto was smaller.
+                if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
+                    column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
+                sum_width_requests += column->WidthRequest;
+            }
+            else
+            {
+                // Initialize stretch weight
+                if (column->AutoFitQueue != 0x00 || column->StretchWeight < 0.0f || !column_is_resizable)
+                {
+                    if (column->InitStretchWeightOrWidth > 0.0f)
+                        column->StretchWeight = column->InitStretchWeightOrWidth;
+                    else if (table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
+                        column->StretchWeight = (column->WidthAuto / stretch_sum_width_auto) * count_stretch;
+                    else
+                        column->StretchWeight = 1.0f;
+                }
 
-        // Assign final width, record width in case we will need to shrink
-        column->WidthGiven = ImTrunc(ImMax(column->WidthRequest, table->MinColumnWidth));
-        table->ColumnsGivenWidth += column->WidthGiven;
-    }
+                stretch_sum_weights += column->StretchWeight;
+                if (table->LeftMostStretchedColumn == -1 || table->Columns[table->LeftMostStretchedColumn].DisplayOrder > column->DisplayOrder)
+                    table->LeftMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+                if (table->RightMostStretchedColumn == -1 || table->Columns[table->RightMostStretchedColumn].DisplayOrder < column->DisplayOrder)
+                    table->RightMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+            }
+            column->IsPreserveWidthAuto = false;
+            sum_width_requests += table->CellPaddingX * 2.0f;
+        }
+        table->ColumnsEnabledFixedCount = (ImGuiTableColumnIdx)count_fixed;
+        table->ColumnsStretchSumWeights = stretch_sum_weights;
 
-    // [Part 5] Redistribute stretch remainder width due to rounding (remainder width is < 1.0f * number of Stretch column).
-    // Using right-to-left distribution (more likely to match resizing cursor).
-    if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
-        for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
+        // [Part 4] Apply final widths based on requested widths
+        const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
+        float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
+        table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         {
-            if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
+            if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
                 continue;
-            ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
-            if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
-                continue;
-            column->WidthRequest += 1.0f;
-            column->WidthGiven += 1.0f;
-            width_remaining_for_stretched_columns -= 1.0f;
+            ImGuiTableColumn* column = &table->Columns[column_n];
+
+            // Allocate width for stretched/weighted columns (StretchWeight gets converted into WidthRequest)
+            if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+            {
+                float weight_ratio = column->StretchWeight / stretch_sum_weights;
+                column->WidthRequest = IM_TRUNC(ImMax(width_avail_for_stretched_columns * weight_ratio, table->MinColumnWidth) + 0.01f);
+                width_remaining_for_stretched_columns -= column->WidthRequest;
+            }
+
+            // [Resize Rule 1] The right-most Visible column is not resizable if there is at least one Stretch column
+            // See additional comments in TableSetColumnWidth().
+            if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
+                column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+
+            // Assign final width, record width in case we will need to shrink
+            column->WidthGiven = ImTrunc(ImMax(column->WidthRequest, table->MinColumnWidth));
+            table->ColumnsGivenWidth += column->WidthGiven;
         }
 
+        // [Part 5] Redistribute stretch remainder width due to rounding (remainder width is < 1.0f * number of Stretch column).
+        // Using right-to-left distribution (more likely to match resizing cursor).
+        if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
+            for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
+            {
+                if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
+                    continue;
+                ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
+                if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
+                    continue;
+                column->WidthRequest += 1.0f;
+                column->WidthGiven += 1.0f;
+                width_remaining_for_stretched_columns -= 1.0f;
+            }
+
+        table->LayoutCacheFlags = table->Flags;
+        table->LayoutCacheWidthAvail = width_avail;
+        table->LayoutCacheWidthSpacings = width_spacings;
+        table->LayoutCacheCellPaddingX = table->CellPaddingX;
+        table->IsLayoutCacheValid = layout_cache_store;
+    }
+
     // Determine if table is hovered which will be used to flag columns as hovered.
     // - In principle we'd like to use the equivalent of IsItemHovered(ImGuiHoveredFlags_AllowWhenBlockedByActiveItem),
     //   but because our item is partially submitted at this point we use ItemHoverable() and a workaround (temporarily
@@ -1099,6 +1138,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
     ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    table->ColumnsVisibleCount = 0;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -1135,9 +1175,12 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->MinX = offset_x;
 
         // Lock width based on start position and minimum/maximum width for this position
+        const float width_given_unclamped = column->WidthGiven;
         column->WidthMax = TableCalcMaxColumnWidth(table, column_n);
         column->WidthGiven = ImMin(column->WidthGiven, column->WidthMax);
         column->WidthGiven = ImMax(column->WidthGiven, ImMin(column->WidthRequest, table->MinColumnWidth));
+        if (column->WidthGiven != width_given_unclamped)
+            table->IsLayoutCacheValid = false; // Width computed by Part 4 is lost
         column->MaxX = offset_x + column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
 
         // Lock other positions
@@ -1166,7 +1209,10 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
         const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
         if (is_visible)
+        {
             ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
+            table->ColumnsVisibleCount++;
+        }
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
@@ -1377,8 +1423,12 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
         if (!column->IsVisibleX && table->LastResizedColumn != column_n)
             continue;
 
-        ImGuiID column_id = TableGetColumnResizeID(table, column_n, table->InstanceCurrent);
+        // Skip borders which are not hovered and not being held (most of them, most of the time)
         ImRect hit_rect(column->MaxX - hit_half_width, hit_y1, column->MaxX + hit_half_width, border_y2_hit);
+        if (table->LastResizedColumn != column_n && !IsMouseHoveringRect(hit_rect.Min, hit_rect.Max))
+            continue;
+
+        ImGuiID column_id = TableGetColumnResizeID(table, column_n, table->InstanceCurrent);
         ItemAdd(hit_rect, column_id, NULL, ImGuiItemFlags_NoNav);
         //GetForegroundDrawList()->AddRect(hit_rect.Min, hit_rect.Max, IM_COL32(255, 0, 0, 100));
 
@@ -1689,6 +1739,8 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
     flags = column->Flags;
 
     // Initialize defaults
+    if (column->InitStretchWeightOrWidth != init_width_or_weight)
+        table->IsLayoutCacheValid = false;
     column->InitStretchWeightOrWidth = init_width_or_weight;
     if (table->IsInitializing)
     {
@@ -1703,7 +1755,7 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
     column->NameOffset = -1;
     if (label != NULL && label[0] != 0)
     {
-        column->NameOffset = (ImS16)table->ColumnsNames.size();
+        column->NameOffset = table->ColumnsNames.size();
         table->ColumnsNames.append(label, label + ImStrlen(label) + 1);
     }
 }
@@ -1715,7 +1767,7 @@ void ImGui::TableSetupScrollFreeze(int columns, int rows)
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT_USER_ERROR_RET(table != NULL, "Call should only be done while in BeginTable() scope!");
     IM_ASSERT(table->IsLayoutLocked == false && "TableSetupColumn(): need to call before first row!");
-    IM_ASSERT(columns >= 0 && columns < IMGUI_TABLE_MAX_COLUMNS);
+    IM_ASSERT(columns >= 0 && columns < ((table->Flags & ImGuiTableFlags_Virtualized) ? IMGUI_TABLE_MAX_COLUMNS_VIRTUALIZED : IMGUI_TABLE_MAX_COLUMNS));
     IM_ASSERT(rows >= 0 && rows < 128); // Arbitrary limit
 
     table->FreezeColumnsRequest = (table->Flags & ImGuiTableFlags_ScrollX) ? (ImGuiTableColumnIdx)ImMin(columns, table->ColumnsCount) : 0;
@@ -1902,6 +1954,12 @@ void ImGui::TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n
 // - TableNextRow()
 // - TableBeginRow() [Internal]
 // - TableEndRow() [Internal]
+// - TableNextRowCached()
+// - TableRowsCacheUpdateFrame() [Internal]
+// - TableRowsCacheBeginCell() [Internal]
+// - TableRowsCacheEndCell() [Internal]
+// - TableRowsCacheEndRow() [Internal]
+// - TableRowsCacheReplay() [Internal]
 //-------------------------------------------------------------------------
 
 // [Public] Note: for row coloring we use ->RowBgColorCounter which is the same value without counting header rows
@@ -1990,6 +2048,8 @@ void ImGui::TableEndRow(ImGuiTable* table)
         TableEndCell(table);
         table->CurrentColumn = -1;
     }
+    if (table->RowsCacheRecordIdx != -1)
+        TableRowsCacheEndRow(table);
 
     // Logging
     if (g.LogEnabled)
@@ -2124,12 +2184,333 @@ void ImGui::TableEndRow(ImGuiTable* table)
     table->IsInsideRow = false;
 }
 
+// [Public] Starts into the first cell of a new row, or replay the row output recorded on a previous frame.
+// - Return false when the row was replayed: don't submit its cells. Return true otherwise: submit cells as with TableNextRow().
+// - 'row_id' identifies the row across frames (e.g. hash or index of the underlying item).
+//   'row_version' needs to change whenever anything displayed in the row changes (e.g. increment it when modifying the underlying item).
+// - Rows are only recorded when fully visible and not interacted with. They are always submitted when hovered, while an item
+//   of the table is active, while using keyboard/gamepad navigation into the table, while a popup is open, during drag and drop,
+//   box-selection or logging, and for frozen or header rows.
+// - Replayed rows submit no items: IDs are not kept alive, and the row won't appear in e.g. ImGuiListClipper item tracking or Nav scoring
+//   until it is submitted again (which happens as soon as it gets hovered or navigated to).
+// - Rows whose cells output to other draw channels or clip rectangles, or append child windows, are not recorded.
+bool ImGui::TableNextRowCached(ImGuiID row_id, ImU64 row_version, ImGuiTableRowFlags row_flags, float row_min_height)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT_USER_ERROR_RETV(table != NULL, false, "Call should only be done while in BeginTable() scope!");
+
+    TableNextRow(row_flags, row_min_height);
+    if (!table->IsUnfrozenRows || (row_flags & ImGuiTableRowFlags_Headers) || table->HostSkipItems)
+        return true;
+    if (table->RowsCacheFrame != g.FrameCount)
+        TableRowsCacheUpdateFrame(table);
+    if (table->RowsCacheBlocked)
+        return true;
+
+    // Lookup
+    ImGuiWindow* window = table->InnerWindow;
+    const ImGuiID key = ImHashData(&row_id, sizeof(row_id), TableGetInstanceID(table, table->InstanceCurrent));
+    ImVector<ImGuiStoragePair>& map_data = table->RowsCacheMap.Data;
+    ImGuiStoragePair* map_pair = ImLowerBound(map_data.Data, map_data.Data + map_data.Size, key);
+    if (map_pair == map_data.Data + map_data.Size || map_pair->key != key)
+        map_pair = NULL;
+    int cache_idx = map_pair ? map_pair->val_i : -1;
+    ImGuiTableRowCache* row_cache = (cache_idx != -1) ? &table->RowsCache[cache_idx] : NULL;
+    if (row_cache && (row_cache->RowId != row_id || row_cache->InstanceNo != table->InstanceCurrent))
+        row_cache = NULL;
+
+    // Replay
+    const bool row_state_matches = row_cache && row_cache->IsValid && row_cache->Version == row_version && row_cache->LayoutHash == table->RowsCacheLayoutHash
+        && row_cache->Alpha == g.Style.Alpha && row_cache->ColorStackSize == g.ColorStack.Size && row_cache->StyleVarStackSize == g.StyleVarStack.Size
+        && row_cache->Font == g.Font && row_cache->FontSize == g.FontSize && row_cache->TexRef == window->DrawList->_CmdHeader.TexRef;
+    if (row_state_matches)
+    {
+        row_cache->LastFrameUsed = g.FrameCount;
+        const float y1 = table->RowPosY1;
+        const float y2 = table->RowPosY1 + row_cache->Height;
+        const bool is_hovered = (g.HoveredWindow == window) && g.IO.MousePos.y >= y1 && g.IO.MousePos.y < y2;
+        const bool is_fully_visible = (y1 >= table->BgClipRect.Min.y && y2 <= table->BgClipRect.Max.y);
+        if (is_hovered || !is_fully_visible)
+            return true; // Submit as usual and keep recorded output, which was drawn without hovering and without clipping
+        TableRowsCacheReplay(table, row_cache);
+        return false;
+    }
+
+    // Record: reuse an entry which wasn't used during this frame or the previous one
+    // (an entry in use can't become free during the frame, so we resume the search where previous one ended)
+    if (row_cache == NULL)
+    {
+        for (int n = table->RowsCacheFreeSearchIdx; n < table->RowsCache.Size && row_cache == NULL; n++)
+            if (table->RowsCache[n].LastFrameUsed < g.FrameCount - 1)
+                cache_idx = n, row_cache = &table->RowsCache[n];
+        if (row_cache == NULL)
+        {
+            cache_idx = table->RowsCache.Size;
+            table->RowsCache.push_back(ImGuiTableRowCache());
+            row_cache = &table->RowsCache.back();
+        }
+        else if (row_cache->LastFrameUsed != -1)
+        {
+            // Entries which can be reused were recorded before last update, so their key is in RowsCacheMap (don't insert, keep 'map_pair' valid)
+            ImGuiStoragePair* old_pair = ImLowerBound(map_data.Data, map_data.Data + map_data.Size, row_cache->Key);
+            if (old_pair != map_data.Data + map_data.Size && old_pair->key == row_cache->Key)
+                old_pair->val_i = -1;
+        }
+        table->RowsCacheFreeSearchIdx = cache_idx + 1;
+
+        // Remove stale keys
+        if (map_data.Size > table->RowsCache.Size * 2 + 64)
+        {
+            map_data.resize(0);
+            for (int n = 0; n < table->RowsCache.Size; n++)
+                if (n != cache_idx && table->RowsCache[n].LastFrameUsed != -1)
+                    map_data.push_back(ImGuiStoragePair(table->RowsCache[n].Key, n));
+            table->RowsCacheMap.BuildSortByKey();
+            table->RowsCacheMapPending.Data.resize(0);
+            map_pair = NULL;
+        }
+
+        // New keys are merged into RowsCacheMap on next frame, so recording many rows doesn't insert into a sorted array for every row
+        if (map_pair != NULL)
+            map_pair->val_i = cache_idx;
+        else
+            table->RowsCacheMapPending.Data.push_back(ImGuiStoragePair(key, cache_idx));
+    }
+    row_cache->RowId = row_id;
+    row_cache->Key = key;
+    row_cache->Version = row_version;
+    row_cache->InstanceNo = table->InstanceCurrent;
+    row_cache->LastFrameUsed = g.FrameCount;
+    row_cache->LayoutHash = table->RowsCacheLayoutHash;
+    row_cache->Alpha = g.Style.Alpha;
+    row_cache->ColorStackSize = g.ColorStack.Size;
+    row_cache->StyleVarStackSize = g.StyleVarStack.Size;
+    row_cache->Font = g.Font;
+    row_cache->FontSize = g.FontSize;
+    row_cache->TexRef = window->DrawList->_CmdHeader.TexRef;
+    row_cache->IsValid = false;
+    row_cache->Cells.resize(0);
+    row_cache->CellsBgColor.resize(0);
+    row_cache->VtxBuffer.resize(0);
+    row_cache->IdxBuffer.resize(0);
+    table->RowsCacheRecordIdx = cache_idx;
+    table->TempData->RowsCacheWindowsActiveCount = g.WindowsActiveCount;
+    table->TempData->RowsCacheClipRangeY = ImVec2(-FLT_MAX, +FLT_MAX);
+    return true;
+}
+
+// [Internal] Called by TableNextRowCached() on the first row of a frame
+void ImGui::TableRowsCacheUpdateFrame(ImGuiTable* table)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = table->InnerWindow;
+    table->RowsCacheFrame = g.FrameCount;
+    table->RowsCacheFreeSearchIdx = 0;
+
+    // Merge keys of rows recorded since last update (both arrays are sorted)
+    ImVector<ImGuiStoragePair>& pending = table->RowsCacheMapPending.Data;
+    if (pending.Size > 0)
+    {
+        table->RowsCacheMapPending.BuildSortByKey();
+        ImVector<ImGuiStoragePair>& map_data = table->RowsCacheMap.Data;
+        int src_n = map_data.Size - 1;
+        map_data.resize(map_data.Size + pending.Size);
+        int dst_n = map_data.Size - 1;
+        for (int pending_n = pending.Size - 1; pending_n >= 0; pending_n--)
+        {
+            while (src_n >= 0 && map_data[src_n].key > pending[pending_n].key)
+                map_data[dst_n--] = map_data[src_n--];
+            map_data[dst_n--] = pending[pending_n];
+        }
+        pending.resize(0);
+    }
+
+    // Interactions which require items to be submitted
+    const bool nav_in_table = (g.NavWindow == window) && (g.NavCursorVisible || g.NavMoveScoringItems || g.NavInitRequest);
+    table->RowsCacheBlocked = (g.ActiveId != 0 && g.ActiveIdWindow == window) || (g.ActiveIdPreviousFrame != g.ActiveId) || nav_in_table
+        || (g.OpenPopupStack.Size > g.BeginPopupStack.Size) || g.DragDropActive || g.BoxSelectState.IsActive || (g.CurrentMultiSelect != NULL) || g.LogEnabled;
+
+    // Style and font atlas state baked in recorded vertices
+    ImFontAtlas* atlas = g.IO.Fonts;
+    ImGuiID context_hash = ImHashData(&g.Style, sizeof(g.Style));
+    context_hash = ImHashData(&atlas->TexUvScale, sizeof(atlas->TexUvScale), context_hash);
+    context_hash = ImHashData(&atlas->TexUvWhitePixel, sizeof(atlas->TexUvWhitePixel), context_hash);
+    if (table->RowsCacheContextHash != context_hash)
+    {
+        table->RowsCacheContextHash = context_hash;
+        for (ImGuiTableRowCache& row_cache : table->RowsCache)
+            row_cache.IsValid = false;
+    }
+
+    // Visible columns, their widths and whether they are clipped. Changes of position (e.g. scrolling) are handled by translating vertices.
+    ImGuiID layout_hash = 0;
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    {
+        const ImGuiTableColumn* column = &table->Columns[column_n];
+        if (!column->IsRequestOutput)
+            continue;
+        const bool is_fully_visible = (column->ClipRect.Min.x <= column->WorkMinX && column->ClipRect.Max.x >= column->WorkMaxX);
+        const float column_data[4] = { (float)column_n, column->WorkMaxX - column->WorkMinX, column->IsSkipItems ? 1.0f : 0.0f, is_fully_visible ? 1.0f : 0.0f };
+        layout_hash = ImHashData(column_data, sizeof(column_data), layout_hash);
+    }
+    table->RowsCacheLayoutHash = layout_hash;
+}
+
+// [Internal] Called by TableBeginCell() while recording a row
+void ImGui::TableRowsCacheBeginCell(ImGuiTable* table)
+{
+    ImGuiWindow* window = table->InnerWindow;
+    ImDrawList* draw_list = window->DrawList;
+    ImGuiTableTempData* temp_data = table->TempData;
+    ImGuiTableRowCache* row_cache = &table->RowsCache[table->RowsCacheRecordIdx];
+
+    ImGuiTableRowCacheCell cell;
+    cell.StartPos = window->DC.CursorPos;
+    cell.CursorMaxPos = ImVec2(0.0f, 0.0f);
+    cell.PrevLineTextBaseOffset = 0.0f;
+    cell.VtxCount = cell.IdxCount = 0;
+    cell.Column = (ImGuiTableColumnIdx)table->CurrentColumn;
+    row_cache->Cells.push_back(cell);
+
+    temp_data->RowsCacheCellVtxStart = draw_list->VtxBuffer.Size;
+    temp_data->RowsCacheCellIdxStart = draw_list->IdxBuffer.Size;
+    temp_data->RowsCacheCellCmdCount = draw_list->CmdBuffer.Size;
+    temp_data->RowsCacheCellVtxCurrentIdx = draw_list->_VtxCurrentIdx;
+    temp_data->RowsCacheCellChannel = table->DrawSplitter->_Current;
+    if (!table->Columns[table->CurrentColumn].IsSkipItems)
+    {
+        temp_data->RowsCacheClipRangeY.x = ImMax(temp_data->RowsCacheClipRangeY.x, window->ClipRect.Min.y);
+        temp_data->RowsCacheClipRangeY.y = ImMin(temp_data->RowsCacheClipRangeY.y, window->ClipRect.Max.y);
+    }
+}
+
+// [Internal] Called by TableEndCell() while recording a row
+void ImGui::TableRowsCacheEndCell(ImGuiTable* table)
+{
+    ImGuiWindow* window = table->InnerWindow;
+    ImDrawList* draw_list = window->DrawList;
+    ImGuiTableTempData* temp_data = table->TempData;
+    ImGuiTableRowCache* row_cache = &table->RowsCache[table->RowsCacheRecordIdx];
+    ImGuiTableRowCacheCell* cell = &row_cache->Cells.back();
+    const ImGuiTableColumn* column = &table->Columns[cell->Column];
+
+    // Cell output needs to be contiguous in a single draw command, and not culled by the column clipping rectangle.
+    const int vtx_count = draw_list->VtxBuffer.Size - temp_data->RowsCacheCellVtxStart;
+    const int idx_count = draw_list->IdxBuffer.Size - temp_data->RowsCacheCellIdxStart;
+    bool can_record = draw_list->CmdBuffer.Size == temp_data->RowsCacheCellCmdCount && table->DrawSplitter->_Current == temp_data->RowsCacheCellChannel;
+    can_record &= (draw_list->_VtxCurrentIdx - temp_data->RowsCacheCellVtxCurrentIdx == (unsigned int)vtx_count) && vtx_count >= 0 && idx_count >= 0;
+    can_record &= (draw_list->_CmdHeader.TexRef == row_cache->TexRef);
+    can_record &= column->IsSkipItems || (column->ClipRect.Min.x <= cell->StartPos.x && column->ClipRect.Max.x >= window->DC.CursorMaxPos.x);
+    if (!can_record)
+    {
+        table->RowsCacheRecordIdx = -1;
+        return;
+    }
+
+    cell->VtxCount = vtx_count;
+    cell->IdxCount = idx_count;
+    cell->CursorMaxPos = window->DC.CursorMaxPos - cell->StartPos;
+    cell->PrevLineTextBaseOffset = window->DC.PrevLineTextBaseOffset;
+    if (vtx_count > 0)
+    {
+        row_cache->VtxBuffer.reserve(row_cache->VtxBuffer.Size + vtx_count);
+        memcpy(row_cache->VtxBuffer.Data + row_cache->VtxBuffer.Size, draw_list->VtxBuffer.Data + temp_data->RowsCacheCellVtxStart, (size_t)vtx_count * sizeof(ImDrawVert));
+        row_cache->VtxBuffer.Size += vtx_count;
+    }
+    if (idx_count > 0)
+    {
+        row_cache->IdxBuffer.reserve(row_cache->IdxBuffer.Size + idx_count);
+        const ImDrawIdx* src_idx = draw_list->IdxBuffer.Data + temp_data->RowsCacheCellIdxStart;
+        ImDrawIdx* dst_idx = row_cache->IdxBuffer.Data + row_cache->IdxBuffer.Size;
+        const unsigned int vtx_base = temp_data->RowsCacheCellVtxCurrentIdx;
+        for (int n = 0; n < idx_count; n++)
+            dst_idx[n] = (ImDrawIdx)(src_idx[n] - vtx_base);
+        row_cache->IdxBuffer.Size += idx_count;
+    }
+}
+
+// [Internal] Called by TableEndRow() while recording a row
+void ImGui::TableRowsCacheEndRow(ImGuiTable* table)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = table->InnerWindow;
+    ImGuiTableTempData* temp_data = table->TempData;
+    ImGuiTableRowCache* row_cache = &table->RowsCache[table->RowsCacheRecordIdx];
+    table->RowsCacheRecordIdx = -1;
+
+    // Only keep rows which were entirely visible (partially visible contents may have been culled), not hovered or interacted with,
+    // and which didn't append other windows.
+    const float y1 = table->RowPosY1;
+    const float y2 = table->RowPosY2;
+    if (y1 < temp_data->RowsCacheClipRangeY.x || y2 > temp_data->RowsCacheClipRangeY.y)
+        return;
+    if (g.HoveredWindow == window && g.IO.MousePos.y >= y1 && g.IO.MousePos.y < y2)
+        return;
+    if ((g.ActiveId != 0 && g.ActiveIdWindow == window) || (g.NavWindow == window && g.NavCursorVisible) || g.WindowsActiveCount != temp_data->RowsCacheWindowsActiveCount)
+        return;
+
+    row_cache->Height = y2 - y1;
+    row_cache->RowBgColor[0] = table->RowBgColor[0];
+    row_cache->RowBgColor[1] = table->RowBgColor[1];
+    for (int n = 0; n <= table->RowCellDataCurrent; n++)
+        row_cache->CellsBgColor.push_back(table->RowCellData[n]);
+    row_cache->IsValid = true;
+}
+
+// [Internal] Called by TableNextRowCached(): append recorded vertices translated to the new row position
+void ImGui::TableRowsCacheReplay(ImGuiTable* table, ImGuiTableRowCache* row_cache)
+{
+    ImGuiWindow* window = table->InnerWindow;
+    const ImDrawVert* src_vtx = row_cache->VtxBuffer.Data;
+    const ImDrawIdx* src_idx = row_cache->IdxBuffer.Data;
+    for (const ImGuiTableRowCacheCell& cell : row_cache->Cells)
+    {
+        TableSetColumnIndex(cell.Column);
+        const ImVec2 offset = window->DC.CursorPos - cell.StartPos;
+        if (cell.VtxCount > 0)
+        {
+            ImDrawList* draw_list = window->DrawList;
+            draw_list->PrimReserve(cell.IdxCount, cell.VtxCount);
+            const unsigned int vtx_base = draw_list->_VtxCurrentIdx;
+            ImDrawVert* dst_vtx = draw_list->_VtxWritePtr;
+            for (int n = 0; n < cell.VtxCount; n++)
+            {
+                dst_vtx[n] = src_vtx[n];
+                dst_vtx[n].pos.x += offset.x;
+                dst_vtx[n].pos.y += offset.y;
+            }
+            ImDrawIdx* dst_idx = draw_list->_IdxWritePtr;
+            for (int n = 0; n < cell.IdxCount; n++)
+                dst_idx[n] = (ImDrawIdx)(src_idx[n] + vtx_base);
+            draw_list->_VtxWritePtr += cell.VtxCount;
+            draw_list->_IdxWritePtr += cell.IdxCount;
+            draw_list->_VtxCurrentIdx += (unsigned int)cell.VtxCount;
+        }
+        src_vtx += cell.VtxCount;
+        src_idx += cell.IdxCount;
+        window->DC.CursorMaxPos = window->DC.CursorPos + cell.CursorMaxPos;
+        window->DC.PrevLineTextBaseOffset = cell.PrevLineTextBaseOffset;
+    }
+
+    // Background colors are drawn by TableEndRow()
+    for (int bg_idx = 0; bg_idx < 2; bg_idx++)
+        if (row_cache->RowBgColor[bg_idx] != IM_COL32_DISABLE)
+            TableSetBgColor(bg_idx ? ImGuiTableBgTarget_RowBg1 : ImGuiTableBgTarget_RowBg0, row_cache->RowBgColor[bg_idx]);
+    for (const ImGuiTableCellData& cell_data : row_cache->CellsBgColor)
+        TableSetBgColor(ImGuiTableBgTarget_CellBg, cell_data.BgColor, cell_data.Column);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Columns changes
 //-------------------------------------------------------------------------
 // - TableGetColumnIndex()
 // - TableSetColumnIndex()
 // - TableNextColumn()
+// - TableVirtualCells()
+// - TableVirtualCellsEx() [Internal]
+// - TableDataSourceCell() [Internal]
+// - ImGuiTableDataSource
 // - TableBeginCell() [Internal]
 // - TableEndCell() [Internal]
 //-------------------------------------------------------------------------
@@ -2189,6 +2570,133 @@ bool ImGui::TableNextColumn()
     return table->Columns[table->CurrentColumn].IsRequestOutput;
 }
 
+// [Public] Submit rows with a callback, visiting only the cells which are in view.
+// - Rows are clipped with ImGuiListClipper, columns are clipped using the layout computed by TableUpdateLayout().
+// - The nearest enabled column on each side of the visible range is also submitted, so keyboard/gamepad navigation can scroll into it.
+// - Columns queued for auto-fit are submitted for the few frames they request output, otherwise columns out of view never report their contents width.
+// - ID stack is pushed with row_n then column_n around each call, so identical labels in different cells don't conflict.
+void ImGui::TableVirtualCells(int rows_count, ImGuiTableCellCallback cell_func, void* user_data, float row_height)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT_USER_ERROR_RET(table != NULL, "Call should only be done while in BeginTable() scope!");
+    IM_ASSERT(cell_func != NULL);
+    TableVirtualCellsEx(table, rows_count, cell_func, user_data, row_height, NULL, NULL);
+}
+
+// [Public] Submit rows as text cells fetched from a data source, drawing placeholders for rows which are not ready yet.
+// - Rows in view are requested after submitting them: with an asynchronous source, newly scrolled rows show placeholders until they are ready.
+// - The visible range is the largest range displayed by the clipper, ignoring the smaller ranges added for frozen rows and navigation.
+void ImGui::TableVirtualCells(ImGuiTableDataSource* source, float row_height)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT_USER_ERROR_RET(table != NULL, "Call should only be done while in BeginTable() scope!");
+    IM_ASSERT(source != NULL && source->GetCellTextFunc != NULL && "Need to provide a GetCellTextFunc!");
+    IM_ASSERT(source->RowsCount >= 0 && source->PrefetchRows >= 0);
+
+    // All rows need the same height, whether they are placeholders or not.
+    if (row_height <= 0.0f)
+        row_height = g.FontSize + g.Style.CellPadding.y * 2.0f;
+    int visible_start, visible_end;
+    TableVirtualCellsEx(table, source->RowsCount, TableDataSourceCell, (void*)source, row_height, &visible_start, &visible_end);
+    if (source->RequestRowsFunc == NULL || visible_start >= visible_end)
+        return;
+    if (visible_start >= source->RequestedRowStart && visible_end <= source->RequestedRowEnd)
+        return;
+    source->RequestedRowStart = ImMax(visible_start - source->PrefetchRows, 0);
+    source->RequestedRowEnd = ImMin(visible_end + source->PrefetchRows, source->RowsCount);
+    source->RequestRowsFunc(source->UserData, source->RequestedRowStart, source->RequestedRowEnd);
+}
+
+// [Internal] Optionally output the largest range of rows displayed by the clipper: [*out_visible_start, *out_visible_end).
+void ImGui::TableVirtualCellsEx(ImGuiTable* table, int rows_count, ImGuiTableCellCallback cell_func, void* user_data, float row_height, int* out_visible_start, int* out_visible_end)
+{
+    if (!table->IsLayoutLocked)
+        TableUpdateLayout(table);
+
+    // Gather columns to submit, in display order. Visibility is locked for the remainder of the frame.
+    ImGuiTableTempData* temp_data = table->TempData;
+    temp_data->VirtualColumns.resize(0);
+    if (!table->HostSkipItems)
+        for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+        {
+            if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
+                continue;
+            const int column_n = table->DisplayOrderToIndex[order_n];
+            const ImGuiTableColumn* column = &table->Columns[column_n];
+            if (column->IsRequestOutput
+                || (column->PrevEnabledColumn != -1 && IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, column->PrevEnabledColumn))
+                || (column->NextEnabledColumn != -1 && IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, column->NextEnabledColumn)))
+                temp_data->VirtualColumns.push_back((ImGuiTableColumnIdx)column_n);
+        }
+
+    const float row_min_height = (row_height > 0.0f) ? row_height : 0.0f;
+    int visible_start = 0, visible_end = 0;
+    ImGuiListClipper clipper;
+    clipper.Begin(rows_count, row_height);
+    while (clipper.Step())
+    {
+        if (clipper.DisplayEnd - clipper.DisplayStart > visible_end - visible_start)
+        {
+            visible_start = clipper.DisplayStart;
+            visible_end = clipper.DisplayEnd;
+        }
+        for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+        {
+            TableNextRow(ImGuiTableRowFlags_None, row_min_height);
+            PushID(row_n);
+            for (int n = 0; n < table->TempData->VirtualColumns.Size; n++) // Don't hold on temp_data: a nested BeginTable() may reallocate g.TablesTempData[]
+            {
+                const int column_n = table->TempData->VirtualColumns[n];
+                TableSetColumnIndex(column_n);
+                PushID(column_n);
+                cell_func(user_data, row_n, column_n);
+                PopID();
+            }
+            PopID();
+        }
+    }
+    if (out_visible_start)
+        *out_visible_start = visible_start;
+    if (out_visible_end)
+        *out_visible_end = visible_end;
+}
+
+// [Internal] Cell callback used by TableVirtualCells() with a data source.
+void ImGui::TableDataSourceCell(void* user_data, int row_n, int column_n)
+{
+    ImGuiTableDataSource* source = (ImGuiTableDataSource*)user_data;
+    const char* text_end = NULL;
+    if (const char* text = source->GetCellTextFunc(source->UserData, row_n, column_n, &text_end))
+    {
+        TextUnformatted(text, text_end);
+        return;
+    }
+
+    // Placeholder: a single line of text filling the cell. Report no width so it doesn't affect auto-fitting columns.
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (window->SkipItems)
+        return;
+    const ImVec2 pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
+    const ImRect bb(pos, ImVec2(ImMax(pos.x, window->WorkRect.Max.x), pos.y + g.FontSize));
+    ItemSize(ImVec2(0.0f, g.FontSize), 0.0f);
+    if (!ItemAdd(bb, 0))
+        return;
+    window->DrawList->AddRectFilled(bb.Min, bb.Max, GetColorU32(ImGuiCol_TextDisabled, 0.25f), g.Style.FrameRounding);
+}
+
+ImGuiTableDataSource::ImGuiTableDataSource()
+{
+    UserData = NULL;
+    RowsCount = 0;
+    PrefetchRows = 32;
+    RequestRowsFunc = NULL;
+    GetCellTextFunc = NULL;
+    ClearRequests();
+}
+
 
 // [Internal] Called by TableSetColumnIndex()/TableNextColumn()
 // This is called very frequently, so we need to be mindful of unnecessary overhead.
@@ -2246,6 +2754,9 @@ void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
         LogRenderedText(&window->DC.CursorPos, "|");
         g.LogLinePosY = FLT_MAX;
     }
+
+    if (table->RowsCacheRecordIdx != -1)
+        TableRowsCacheBeginCell(table);
 }
 
 // [Internal] Called by TableNextRow()/TableSetColumnIndex()/TableNextColumn()
@@ -2254,6 +2765,8 @@ void ImGui::TableEndCell(ImGuiTable* table)
     ImGuiTableColumn* column = &table->Columns[table->CurrentColumn];
     ImGuiWindow* window = table->InnerWindow;
 
+    if (table->RowsCacheRecordIdx != -1)
+        TableRowsCacheEndCell(table);
     if (window->DC.IsSetPos)
         ErrorCheckUsingSetCursorPosToExtendParentBoundaries();
 
@@ -2559,7 +3072,7 @@ void ImGui::TablePopColumnChannel()
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsVisibleCount; // Clipped columns share the dummy channel, so very wide tables only pay for what's in view.
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
     const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
@@ -2627,6 +3140,7 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_ZONE("TableMergeDrawChannels");
     ImDrawListSplitter* splitter = table->DrawSplitter;
     const bool has_freeze_v = (table->FreezeRowsCount > 0);
     const bool has_freeze_h = (table->FreezeColumnsCount > 0);
@@ -2905,6 +3419,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // - TableSetColumnSortDirection() [Internal]
 // - TableSortSpecsSanitize() [Internal]
 // - TableSortSpecsBuild() [Internal]
+// - ImGuiTableSortStorage
 //-------------------------------------------------------------------------
 
 // Return NULL if no sort specs (most often when ImGuiTableFlags_Sortable is not set)
@@ -3091,6 +3606,274 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+// Compare using all specs in priority order, then item index as a tie-breaker so we always have a total order.
+static int TableSortStorageCompare(const ImGuiTableSortStorage* storage, int item_a, int item_b)
+{
+    for (const ImGuiTableColumnSortSpecs& spec : storage->_Specs)
+        if (int delta = storage->CompareFunc(storage->UserData, &spec, item_a, item_b))
+            return (spec.SortDirection == ImGuiSortDirection_Descending) ? -delta : delta;
+    return (item_a > item_b) - (item_a < item_b);
+}
+
+static void TableSortStorageMerge(const ImGuiTableSortStorage* storage, const int* a, int a_count, const int* b, int b_count, int* out)
+{
+    // Fast path for runs which are already in order (frequent when data is mostly sorted)
+    if (a_count > 0 && b_count > 0 && TableSortStorageCompare(storage, a[a_count - 1], b[0]) > 0)
+    {
+        if (b_count * 16 < a_count)
+        {
+            // Merging few items into a large run (incremental update): binary search insertion points in O(K log N) comparisons.
+            for (; b_count > 0; b++, b_count--)
+            {
+                int lo = 0, hi = a_count;
+                while (lo < hi)
+                {
+                    const int mid = lo + ((hi - lo) >> 1);
+                    if (TableSortStorageCompare(storage, a[mid], *b) < 0)
+                        lo = mid + 1;
+                    else
+                        hi = mid;
+                }
+                memcpy(out, a, (size_t)lo * sizeof(int));
+                out += lo;
+                *out++ = *b;
+                a += lo;
+                a_count -= lo;
+            }
+        }
+        else
+        {
+            while (a_count > 0 && b_count > 0)
+            {
+                if (TableSortStorageCompare(storage, *b, *a) < 0)
+                    *out++ = *b++, b_count--;
+                else
+                    *out++ = *a++, a_count--;
+            }
+        }
+    }
+    memcpy(out, a, (size_t)a_count * sizeof(int));
+    memcpy(out + a_count, b, (size_t)b_count * sizeof(int));
+}
+
+// Bottom-up merge sort of data[], using temp[] of same size as scratch. Output in data[].
+// Small runs are first sorted with an insertion sort, which has better locality than the first merge passes.
+static void TableSortStorageMergeSort(const ImGuiTableSortStorage* storage, int* data, int* temp, int count)
+{
+    const int INSERTION_SORT_RUN = 16;
+    for (int run_start = 0; run_start < count; run_start += INSERTION_SORT_RUN)
+    {
+        const int run_end = ImMin(run_start + INSERTION_SORT_RUN, count);
+        for (int n = run_start + 1; n < run_end; n++)
+        {
+            const int item = data[n];
+            int dst_n = n;
+            for (; dst_n > run_start && TableSortStorageCompare(storage, item, data[dst_n - 1]) < 0; dst_n--)
+                data[dst_n] = data[dst_n - 1];
+            data[dst_n] = item;
+        }
+    }
+
+    int* src = data;
+    int* dst = temp;
+    for (int width = INSERTION_SORT_RUN; width < count; width *= 2)
+    {
+        for (int n = 0; n < count; n += width * 2)
+        {
+            const int a_count = ImMin(width, count - n);
+            const int b_count = ImMin(width, count - n - a_count);
+            TableSortStorageMerge(storage, src + n, a_count, src + n + a_count, b_count, dst + n);
+        }
+        ImSwap(src, dst);
+    }
+    if (src != data)
+        memcpy(data, src, (size_t)count * sizeof(int));
+}
+
+// Parallel sort: each job sorts one chunk, then adjacent runs are merged pairwise, one level at a time.
+#define IMGUI_TABLE_SORT_JOBS_COUNT 8
+struct ImGuiTableSortJobs
+{
+    const ImGuiTableSortStorage* Storage;
+    int*    Src;
+    int*    Dst;
+    int     RunChunks;  // Number of chunks per run at current merge level
+    int     ChunkStart[IMGUI_TABLE_SORT_JOBS_COUNT + 1];
+};
+
+static void TableSortStorageJobSortChunk(void* job_data, int job_n)
+{
+    ImGuiTableSortJobs* jobs = (ImGuiTableSortJobs*)job_data;
+    const int start = jobs->ChunkStart[job_n];
+    TableSortStorageMergeSort(jobs->Storage, jobs->Src + start, jobs->Dst + start, jobs->ChunkStart[job_n + 1] - start);
+}
+
+static void TableSortStorageJobMergeRuns(void* job_data, int job_n)
+{
+    ImGuiTableSortJobs* jobs = (ImGuiTableSortJobs*)job_data;
+    const int a_start = jobs->ChunkStart[job_n * 2 * jobs->RunChunks];
+    const int b_start = jobs->ChunkStart[job_n * 2 * jobs->RunChunks + jobs->RunChunks];
+    const int b_end = jobs->ChunkStart[(job_n + 1) * 2 * jobs->RunChunks];
+    TableSortStorageMerge(jobs->Storage, jobs->Src + a_start, b_start - a_start, jobs->Src + b_start, b_end - b_start, jobs->Dst + a_start);
+}
+
+static void TableSortStorageSort(ImGuiTableSortStorage* storage, int* data, int count)
+{
+    storage->_Temp.resize(count);
+    if (storage->ParallelForFunc == NULL || count < storage->ParallelMinItems)
+    {
+        TableSortStorageMergeSort(storage, data, storage->_Temp.Data, count);
+        return;
+    }
+
+    ImGuiTableSortJobs jobs;
+    jobs.Storage = storage;
+    jobs.Src = data;
+    jobs.Dst = storage->_Temp.Data;
+    for (int n = 0; n <= IMGUI_TABLE_SORT_JOBS_COUNT; n++)
+        jobs.ChunkStart[n] = (int)((ImS64)count * n / IMGUI_TABLE_SORT_JOBS_COUNT);
+    storage->ParallelForFunc(storage->UserData, TableSortStorageJobSortChunk, &jobs, IMGUI_TABLE_SORT_JOBS_COUNT);
+    for (jobs.RunChunks = 1; jobs.RunChunks < IMGUI_TABLE_SORT_JOBS_COUNT; jobs.RunChunks *= 2)
+    {
+        storage->ParallelForFunc(storage->UserData, TableSortStorageJobMergeRuns, &jobs, IMGUI_TABLE_SORT_JOBS_COUNT / (jobs.RunChunks * 2));
+        ImSwap(jobs.Src, jobs.Dst);
+    }
+    if (jobs.Src != data)
+        memcpy(data, jobs.Src, (size_t)count * sizeof(int));
+}
+
+ImGuiTableSortStorage::ImGuiTableSortStorage()
+{
+    UserData = NULL;
+    CompareFunc = NULL;
+    ParallelForFunc = NULL;
+    ParallelMinItems = 65536;
+    _FullSortRequest = true;
+}
+
+void ImGuiTableSortStorage::Clear()
+{
+    Items.clear();
+    _Specs.clear();
+    _DirtyItems.clear();
+    _DirtyMask.clear();
+    _Temp.clear();
+    _FullSortRequest = true;
+}
+
+void ImGuiTableSortStorage::MarkItemDirty(int item_idx)
+{
+    IM_ASSERT(item_idx >= 0);
+    if (!_FullSortRequest)
+        _DirtyItems.push_back(item_idx);
+}
+
+void ImGuiTableSortStorage::MarkAllDirty()
+{
+    _FullSortRequest = true;
+    _DirtyItems.resize(0);
+}
+
+bool ImGuiTableSortStorage::ApplySortSpecs(ImGuiTableSortSpecs* sort_specs, int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    IM_ASSERT(CompareFunc != NULL && "Need to provide a CompareFunc!");
+
+    // Detect changes of sort specs. We don't rely on SpecsDirty alone, as user code may have already cleared it.
+    const int specs_count = sort_specs ? sort_specs->SpecsCount : 0;
+    bool specs_changed = (sort_specs && sort_specs->SpecsDirty) || (specs_count != _Specs.Size);
+    for (int n = 0; n < specs_count && !specs_changed; n++)
+    {
+        const ImGuiTableColumnSortSpecs* a = &sort_specs->Specs[n];
+        const ImGuiTableColumnSortSpecs* b = &_Specs[n];
+        specs_changed = (a->ColumnIndex != b->ColumnIndex || a->ColumnUserID != b->ColumnUserID || a->SortDirection != b->SortDirection);
+    }
+    if (specs_changed)
+    {
+        _Specs.resize(specs_count);
+        if (specs_count > 0)
+            memcpy(_Specs.Data, sort_specs->Specs, (size_t)specs_count * sizeof(ImGuiTableColumnSortSpecs));
+        _FullSortRequest = true;
+    }
+    if (sort_specs)
+        sort_specs->SpecsDirty = false;
+
+    // Incremental update: too many changes are better served with a full sort.
+    const int prev_items_count = Items.Size;
+    const int changes_count = _DirtyItems.Size + ImMax(items_count - prev_items_count, 0);
+    if (!_FullSortRequest && changes_count * 4 > items_count)
+        _FullSortRequest = true;
+
+    // Full sort
+    if (_FullSortRequest)
+    {
+        Items.resize(items_count);
+        for (int n = 0; n < items_count; n++)
+            Items[n] = n;
+        if (_Specs.Size > 0)
+            TableSortStorageSort(this, Items.Data, items_count);
+        _DirtyItems.resize(0);
+        _FullSortRequest = false;
+        return true;
+    }
+    if (changes_count == 0 && items_count == prev_items_count)
+        return false;
+
+    // Incremental update, in O(N + K log K) with K == number of changed items:
+    // - 1. Mark dirty items, removed items and new items.
+    // - 2. Take dirty and removed items out of Items[], which remains sorted.
+    // - 3. Sort dirty and new items, then merge the two sorted lists.
+    const int mask_items_count = ImMax(items_count, prev_items_count);
+    _DirtyMask.resize((mask_items_count + 31) >> 5);
+    memset(_DirtyMask.Data, 0, (size_t)_DirtyMask.Size * sizeof(ImU32));
+    for (int item_idx : _DirtyItems)
+        if (item_idx < mask_items_count)
+            ImBitArraySetBit(_DirtyMask.Data, item_idx);
+    if (items_count > prev_items_count)
+        ImBitArraySetBitRange(_DirtyMask.Data, prev_items_count, items_count);
+
+    int* items_end = Items.Data;
+    for (int item_idx : Items)
+        if (item_idx < items_count && !ImBitArrayTestBit(_DirtyMask.Data, item_idx))
+            *items_end++ = item_idx;
+    const int clean_count = (int)(items_end - Items.Data);
+
+    // Gather changed items (de-duplicating them) after the clean items, then sort them
+    Items.resize(items_count);
+    int* changed_end = Items.Data + clean_count;
+    for (int item_idx : _DirtyItems)
+        if (item_idx < items_count && ImBitArrayTestBit(_DirtyMask.Data, item_idx))
+        {
+            *changed_end++ = item_idx;
+            ImBitArrayClearBit(_DirtyMask.Data, item_idx);
+        }
+    for (int item_idx = prev_items_count; item_idx < items_count; item_idx++)
+        if (ImBitArrayTestBit(_DirtyMask.Data, item_idx))
+            *changed_end++ = item_idx;
+    IM_ASSERT(changed_end == Items.Data + items_count);
+    _DirtyItems.resize(0);
+
+    const int changed_count = items_count - clean_count;
+    if (changed_count == 0)
+    {
+        // Only removed trailing items: remaining order is still valid.
+    }
+    else if (_Specs.Size > 0)
+    {
+        TableSortStorageSort(this, Items.Data + clean_count, changed_count);
+        _Temp.resize(items_count);
+        TableSortStorageMerge(this, Items.Data, clean_count, Items.Data + clean_count, changed_count, _Temp.Data);
+        Items.swap(_Temp);
+    }
+    else
+    {
+        // No sort specs: identity order
+        for (int n = 0; n < items_count; n++)
+            Items[n] = n;
+    }
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3114,7 +3897,12 @@ float ImGui::TableGetHeaderRowHeight()
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         if (IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
             if ((table->Columns[column_n].Flags & ImGuiTableColumnFlags_NoHeaderLabel) == 0)
-                row_height = ImMax(row_height, CalcTextSize(TableGetColumnName(table, column_n)).y);
+            {
+                // Single-line labels are always g.FontSize tall: only measure multi-line ones (matters with very wide tables).
+                const char* name = TableGetColumnName(table, column_n);
+                if (strchr(name, '\n') != NULL)
+                    row_height = ImMax(row_height, CalcTextSize(name).y);
+            }
     return row_height + g.Style.CellPadding.y * 2.0f;
 }
 
@@ -3158,6 +3946,9 @@ void ImGui::TableHeadersRow()
     const int columns_count = TableGetColumnCount();
     for (int column_n = 0; column_n < columns_count; column_n++)
     {
+        // Virtualized tables: skip entering cells of clipped columns altogether.
+        if ((table->Flags & ImGuiTableFlags_Virtualized) && !table->Columns[column_n].IsRequestOutput && table->LastHeldHeaderColumn != column_n)
+            continue;
         if (!TableSetColumnIndex(column_n) && table->LastHeldHeaderColumn != column_n)
             continue;
 
@@ -3846,6 +4637,7 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
 
     table->SettingsLoadedFlags = settings->SaveFlags;
     table->RefScale = settings->RefScale;
+    table->IsLayoutCacheValid = false;
 
     // Initialize default columns settings
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
@@ -4070,12 +4862,17 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     table->MemoryCompacted = true;
     for (int n = 0; n < table->ColumnsCount; n++)
         table->Columns[n].NameOffset = -1;
+    table->RowsCache.clear_destruct();
+    table->RowsCacheMap.Clear();
+    table->RowsCacheMapPending.Clear();
+    table->RowsCacheRecordIdx = -1;
     g.TablesLastTimeActive[g.Tables.GetIndex(table)] = -1.0f;
 }
 
 void ImGui::TableGcCompactTransientBuffers(ImGuiTableTempData* temp_data)
 {
     temp_data->DrawSplitter.ClearFreeMemory();
+    temp_data->VirtualColumns.clear();
     temp_data->LastTimeActive = -1.0f;
 }
 
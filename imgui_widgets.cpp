@@ -103,6 +103,7 @@ Index of this file:
 // Widgets
 static const float          DRAGDROP_HOLD_TO_OPEN_TIMER = 0.70f;    // Time for drag-hold to activate items accepting the ImGuiButtonFlags_PressedOnDragDropHold button behavior.
 static const float          DRAG_MOUSE_THRESHOLD_FACTOR = 0.50f;    // Multiplier for the default value of io.MouseDragThreshold to make DragFloat/DragInt react faster to mouse drags.
+static const int            INPUTTEXT_MULTICARET_UNDO_MEMORY_BUDGET = 1024 * 1024; // Undo history budget used after a multi-caret edit when io.ConfigInputTextUndoMemoryBudget == 0.
 
 // Those MIN/MAX values are not define because we need to point to them
 static const signed char    IM_S8_MIN  = -128;
@@ -135,8 +136,25 @@ static const ImU64          IM_U64_MAX = (2ULL * 9223372036854775807LL + 1);
 // [SECTION] Forward Declarations
 //-------------------------------------------------------------------------
 
+static int*     ImLowerBound(int* in_begin, int* in_end, int v);
+
 // For InputTextEx()
 static bool     InputTextFilterCharacter(ImGuiContext* ctx, ImGuiInputTextState* state, unsigned int* p_char, ImGuiInputTextCallback callback, void* user_data, bool input_source_is_clipboard = false);
+static void     InputTextCaptureRevertValue(ImGuiInputTextState* state, ImVector<char>* text_backup);
+static void     InputTextMarkDirty(ImGuiInputTextState* state, int pos, int removed_len, int text_len_before);
+static void     InputTextUndoRecordEdit(ImGuiInputTextState* state, int pos, const char* deleted_text, int deleted_len, const char* inserted_text, int inserted_len);
+static void     InputTextUndoApply(ImGuiInputTextState* state, bool is_redo);
+static void     InputTextStbUndoClear(ImStbTexteditState* stb);
+static void     InputTextSetMainCaret(ImGuiInputTextState* state, const ImGuiInputTextCaret& caret);
+static void     InputTextMultiCaretNormalize(ImGuiInputTextState* state);
+static void     InputTextMultiCaretKey(ImGuiInputTextState* state, int key);
+static bool     InputTextMultiCaretEdit(ImGuiInputTextState* state, int key, const char* text, int text_len, bool distribute_lines);
+static void     InputTextReplaceChars(ImGuiInputTextState* obj, int pos, int n, const char* new_text, int new_text_len);
+static bool     InputTextLineIndexIsValid(ImGuiInputTextState* state, float wrap_width);
+static void     InputTextLineIndexFindParagraph(ImGuiInputTextState* state, int pos_begin, int pos_end, int* out_paragraph_start, int* out_paragraph_end);
+static void     InputTextLineIndexUpdate(ImGuiInputTextState* state, int paragraph_start, int paragraph_end_old, int paragraph_end_new, int delta);
+static int      InputTextLineIndexFindRowFromChar(ImGuiInputTextState* state, int char_idx, int* out_prev_row_start, float* out_row_y);
+static int      InputTextLineIndexFindRowFromY(ImGuiInputTextState* state, float y, float* out_row_y);
 static ImVec2   InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, const char* text_end_display, const char* text_end, const char** out_remaining = NULL, ImVec2* out_offset = NULL, ImDrawTextFlags flags = 0);
 
 //-------------------------------------------------------------------------
@@ -156,6 +174,8 @@ static ImVec2   InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin,
 // - LabelTextV()
 // - BulletText()
 // - BulletTextV()
+// - TextViewer() [Internal]
+// - TextLogView()
 //-------------------------------------------------------------------------
 
 void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
@@ -453,6 +473,260 @@ void ImGui::BulletTextV(const char* fmt, va_list args)
     RenderText(bb.Min + ImVec2(g.FontSize + style.FramePadding.x * 2, 0.0f), text_begin, text_end, false);
 }
 
+ImGuiTextViewer::ImGuiTextViewer()
+{
+    TokenizeFunc = NULL;
+    TokenizeUserData = NULL;
+    MaxTokenizeBytesPerFrame = 1024 * 1024;
+    AutoScroll = true;
+    Generation = 0;
+    MaxLineWidth = 0.0f;
+    Font = NULL;
+    FontSize = 0.0f;
+}
+
+void ImGuiTextViewer::Clear()
+{
+    LineIndex.clear();
+    LineStates.clear();
+    Generation++;
+    MaxLineWidth = 0.0f;
+}
+
+void ImGuiTextViewer::Invalidate(int text_offset)
+{
+    if (text_offset >= LineIndex.EndOffset)
+        return;
+    if (text_offset <= 0)
+    {
+        Clear();
+        return;
+    }
+
+    // Remove lines from the one containing 'text_offset': ImGuiTextIndex::append() will push it again.
+    const int line_n = ImMax((int)(ImLowerBound(LineIndex.Offsets.begin(), LineIndex.Offsets.end(), text_offset + 1) - LineIndex.Offsets.begin()) - 1, 0);
+    LineIndex.EndOffset = LineIndex.Offsets[line_n];
+    LineIndex.Offsets.resize(line_n);
+    if (LineStates.Size > line_n)
+        LineStates.resize(line_n);
+    Generation++;
+}
+
+static void TextViewerGetLineRange(ImGuiTextViewer* viewer, const char* text, int line_n, const char** out_line_begin, const char** out_line_end)
+{
+    const char* line_begin = viewer->LineIndex.get_line_begin(text, line_n);
+    const char* line_end = viewer->LineIndex.get_line_end(text, line_n);
+    if (line_end > line_begin && line_end[-1] == '\n') // Last line includes its trailing \n
+        line_end--;
+    *out_line_begin = line_begin;
+    *out_line_end = line_end;
+}
+
+// Return cached tokenization of a line, tokenizing it if needed
+static ImGuiTextViewerLine* TextViewerGetLine(ImGuiTextViewer* viewer, const char* text, int line_n)
+{
+    const char* line_begin;
+    const char* line_end;
+    TextViewerGetLineRange(viewer, text, line_n, &line_begin, &line_end);
+    const int line_end_offset = (int)(line_end - text);
+    const int state_in = (line_n > 0 && line_n <= viewer->LineStates.Size) ? viewer->LineStates[line_n - 1] : 0;
+    ImGuiTextViewerLine* line = &viewer->LinesCache[line_n & (viewer->LinesCache.Size - 1)];
+    if (line->LineNo == line_n && line->LineEndOffset == line_end_offset && line->StateIn == state_in && line->Generation == viewer->Generation)
+        return line;
+    line->LineNo = line_n;
+    line->LineEndOffset = line_end_offset;
+    line->StateIn = state_in;
+    line->Generation = viewer->Generation;
+
+    // Tokenize, then sanitize spans so that rendering doesn't need to check them
+    const int line_len = (int)(line_end - line_begin);
+    ImVector<ImGuiTextViewerSpan>& spans = line->Spans;
+    spans.resize(0);
+    if (viewer->TokenizeFunc != NULL)
+        viewer->TokenizeFunc(viewer->TokenizeUserData, line_begin, line_end, state_in, &spans);
+    if (spans.Size == 0 || spans[0].Offset > 0)
+    {
+        ImGuiTextViewerSpan span = { 0, 0 };
+        spans.push_front(span);
+    }
+    spans[0].Offset = 0;
+    for (int n = 1; n < spans.Size; n++)
+        spans[n].Offset = ImClamp(spans[n].Offset, spans[n - 1].Offset, line_len);
+
+    // Measure
+    line->SpansX.resize(spans.Size);
+    float x = 0.0f;
+    for (int n = 0; n < spans.Size; n++)
+    {
+        line->SpansX[n] = x;
+        const int span_end = (n + 1 < spans.Size) ? spans[n + 1].Offset : line_len;
+        if (span_end > spans[n].Offset)
+            x += viewer->Font->CalcTextSizeA(viewer->FontSize, FLT_MAX, 0.0f, line_begin + spans[n].Offset, line_begin + span_end).x;
+    }
+    line->Width = x;
+    viewer->MaxLineWidth = ImMax(viewer->MaxLineWidth, x);
+    return line;
+}
+
+// Display a large read-only text buffer, e.g. a log, with colors provided by viewer->TokenizeFunc.
+// The buffer is expected to be append-only between calls: see ImGuiTextViewer for details.
+// - Per-frame cost: index text appended since last frame + tokenize up to MaxTokenizeBytesPerFrame + tokenize visible lines which are not cached.
+// - Lines are not wrapped. Horizontal scrolling extent is the width of the largest line displayed so far.
+void ImGui::TextViewer(const char* str_id, ImGuiTextViewer* viewer, const char* text, const char* text_end, const ImVec2& size_arg, ImGuiChildFlags child_flags)
+{
+    ImGuiContext& g = *GImGui;
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    const int text_size = (int)(text_end - text);
+
+    // Index appended text
+    ImGuiTextViewer* v = viewer;
+    if (text_size < v->LineIndex.EndOffset)
+        v->Clear();
+    const int prev_lines_count = v->LineIndex.size();
+    v->LineIndex.append(text, v->LineIndex.EndOffset, text_size);
+    const int lines_count = v->LineIndex.size();
+    if (v->Font != g.Font || v->FontSize != g.FontSize)
+    {
+        v->Font = g.Font;
+        v->FontSize = g.FontSize;
+        v->MaxLineWidth = 0.0f;
+        v->Generation++;
+    }
+
+    // Catch up on end states of lines, in order. Last line is not complete until it ends with a \n.
+    if (v->TokenizeFunc != NULL)
+    {
+        const int complete_lines_count = (text_size > 0 && text_end[-1] == '\n') ? lines_count : lines_count - 1;
+        int bytes_budget = (v->MaxTokenizeBytesPerFrame > 0) ? v->MaxTokenizeBytesPerFrame : INT_MAX;
+        while (v->LineStates.Size < complete_lines_count && bytes_budget > 0)
+        {
+            const int line_n = v->LineStates.Size;
+            const char* line_begin;
+            const char* line_end;
+            TextViewerGetLineRange(v, text, line_n, &line_begin, &line_end);
+            v->LineStates.push_back(v->TokenizeFunc(v->TokenizeUserData, line_begin, line_end, (line_n > 0) ? v->LineStates[line_n - 1] : 0, NULL));
+            bytes_budget -= (int)(line_end - line_begin) + 1;
+        }
+    }
+
+    if (!BeginChild(str_id, size_arg, child_flags, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        EndChild();
+        return;
+    }
+    ImGuiWindow* window = g.CurrentWindow;
+    const float line_height = g.FontSize;
+
+    // Make sure cache can hold all visible lines
+    const int visible_lines_max = (int)(window->InnerRect.GetHeight() / line_height) + 2;
+    if (v->LinesCache.Size < visible_lines_max)
+    {
+        int cache_size = 64;
+        while (cache_size < visible_lines_max)
+            cache_size *= 2;
+        const int old_size = v->LinesCache.Size;
+        v->LinesCache.resize(cache_size);
+        for (int n = old_size; n < cache_size; n++)
+            IM_PLACEMENT_NEW(&v->LinesCache[n]) ImGuiTextViewerLine();
+        v->Generation++; // Lines are mapped to different entries
+    }
+
+    // Render visible lines
+    ImDrawList* draw_list = window->DrawList;
+    const float start_x = window->DC.CursorPos.x;
+    const float clip_min_x = window->ClipRect.Min.x;
+    const float clip_max_x = window->ClipRect.Max.x;
+    PushStyleVarY(ImGuiStyleVar_ItemSpacing, 0.0f);
+    ImGuiListClipper clipper;
+    clipper.Begin(lines_count, line_height);
+    while (clipper.Step())
+        for (int line_n = clipper.DisplayStart; line_n < clipper.DisplayEnd; line_n++)
+        {
+            ImGuiTextViewerLine* line = TextViewerGetLine(v, text, line_n);
+            const char* line_begin = v->LineIndex.get_line_begin(text, line_n);
+            const ImVec2 pos = window->DC.CursorPos;
+            for (int span_n = 0; span_n < line->Spans.Size; span_n++)
+            {
+                const float span_x1 = pos.x + line->SpansX[span_n];
+                const float span_x2 = pos.x + ((span_n + 1 < line->Spans.Size) ? line->SpansX[span_n + 1] : line->Width);
+                if (span_x1 > clip_max_x)
+                    break;
+                if (span_x2 < clip_min_x)
+                    continue;
+                const ImGuiTextViewerSpan& span = line->Spans[span_n];
+                const int span_end = (span_n + 1 < line->Spans.Size) ? line->Spans[span_n + 1].Offset : line->LineEndOffset - (int)(line_begin - text);
+                const ImU32 col = span.Col ? GetColorU32(span.Col) : GetColorU32(ImGuiCol_Text);
+                draw_list->AddText(v->Font, v->FontSize, ImVec2(span_x1, pos.y), col, line_begin + span.Offset, line_begin + span_end);
+            }
+            ItemSize(ImVec2(line->Width, line_height));
+        }
+    PopStyleVar();
+
+    // Extend horizontal scrolling to the largest line seen so far, so it doesn't change while scrolling
+    window->DC.CursorMaxPos.x = ImMax(window->DC.CursorMaxPos.x, start_x + v->MaxLineWidth);
+    if (v->AutoScroll && lines_count != prev_lines_count && window->Scroll.y >= window->ScrollMax.y)
+        SetScrollHereY(1.0f);
+    EndChild();
+}
+
+// Display lines of a ImGuiTextLog in a child window. Calls log->Flush() to add text appended from other threads.
+// - When the log is in ring mode and oldest lines are dropped, scrolling is adjusted so displayed lines don't move.
+void ImGui::TextLogView(const char* str_id, ImGuiTextLog* log, const ImVec2& size_arg, ImGuiChildFlags child_flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    log->Flush(); // Even when not visible, so text queued by other threads is bounded by MaxSize
+    if (window->SkipItems)
+        return;
+
+    const bool lines_changed = (log->GetLinesDropped() != log->_ViewLinesDropped || log->GetLinesCount() != log->_ViewLinesCount);
+    const int lines_dropped = log->GetLinesDropped() - log->_ViewLinesDropped;
+    log->_ViewLinesDropped = log->GetLinesDropped();
+    log->_ViewLinesCount = log->GetLinesCount();
+
+    // Keep following the bottom, or compensate scrolling for lines dropped since last frame (must be done before BeginChild() uses Scroll)
+    const float line_height = g.FontSize;
+    bool scroll_to_bottom = false;
+    if (ImGuiWindow* child_window = (log->_ViewWindowID != 0) ? FindWindowByID(log->_ViewWindowID) : NULL)
+    {
+        const bool following_tail = child_window->Scroll.y >= child_window->ScrollMax.y || (child_window->ScrollTarget.y < FLT_MAX && child_window->ScrollTargetCenterRatio.y >= 1.0f); // At bottom, or SetScrollHereY(1.0f) from last frame not applied yet
+        if (log->AutoScroll && following_tail)
+            scroll_to_bottom = lines_changed;
+        else if (lines_dropped > 0)
+        {
+            const float dy = lines_dropped * line_height;
+            child_window->Scroll.y = ImMax(child_window->Scroll.y - dy, 0.0f);
+            if (child_window->ScrollTarget.y < FLT_MAX)
+                child_window->ScrollTarget.y = ImMax(child_window->ScrollTarget.y - dy, 0.0f);
+        }
+    }
+
+    const bool child_visible = BeginChild(str_id, size_arg, child_flags, ImGuiWindowFlags_HorizontalScrollbar);
+    log->_ViewWindowID = g.CurrentWindow->ID;
+    if (!child_visible)
+    {
+        EndChild();
+        return;
+    }
+
+    PushStyleVarY(ImGuiStyleVar_ItemSpacing, 0.0f);
+    ImGuiListClipper clipper;
+    clipper.Begin(log->GetLinesCount(), line_height);
+    while (clipper.Step())
+        for (int line_n = clipper.DisplayStart; line_n < clipper.DisplayEnd; line_n++)
+        {
+            const char* line_end;
+            const char* line_begin = log->GetLine(line_n, &line_end);
+            TextUnformatted(line_begin, line_end);
+        }
+    PopStyleVar();
+
+    if (scroll_to_bottom)
+        SetScrollHereY(1.0f);
+    EndChild();
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Main
 //-------------------------------------------------------------------------
@@ -2281,6 +2555,36 @@ const ImGuiDataTypeInfo* ImGui::DataTypeGetInfo(ImGuiDataType data_type)
 
 int ImGui::DataTypeFormatString(char* buf, int buf_size, ImGuiDataType data_type, const void* p_data, const char* format)
 {
+    // Skip vsnprintf() for simple formats matching the data type e.g. "%d" or "%.3f"
+    ImGuiNumberFormat nf;
+    if (ImParseFormatNumber(format, &nf))
+    {
+        const bool is_floating_point = (data_type == ImGuiDataType_Float || data_type == ImGuiDataType_Double);
+        const bool is_64 = (data_type == ImGuiDataType_S64 || data_type == ImGuiDataType_U64);
+        if (nf.Type == 'f' && is_floating_point)
+        {
+            const double v = (data_type == ImGuiDataType_Float) ? (double)*(const float*)p_data : *(const double*)p_data;
+            const int len = ImFormatNumberFloat(buf, (size_t)buf_size, &nf, v);
+            if (len >= 0)
+                return len;
+        }
+        else if (nf.Type != 'f' && data_type <= ImGuiDataType_U64 && nf.Is64 == is_64)
+        {
+            ImS64 v;
+            switch (data_type)
+            {
+            case ImGuiDataType_S8:  v = *(const ImS8*)p_data; break;
+            case ImGuiDataType_U8:  v = *(const ImU8*)p_data; break;
+            case ImGuiDataType_S16: v = *(const ImS16*)p_data; break;
+            case ImGuiDataType_U16: v = *(const ImU16*)p_data; break;
+            case ImGuiDataType_S32: v = *(const ImS32*)p_data; break;
+            case ImGuiDataType_U32: v = *(const ImU32*)p_data; break;
+            default:                v = *(const ImS64*)p_data; break;
+            }
+            return ImFormatNumberInt(buf, (size_t)buf_size, &nf, (ImU64)v);
+        }
+    }
+
     // Signedness doesn't matter when pushing integer arguments
     if (data_type == ImGuiDataType_S32 || data_type == ImGuiDataType_U32)
         return ImFormatString(buf, buf_size, format, *(const ImU32*)p_data);
@@ -4194,16 +4498,29 @@ static int STB_TEXTEDIT_MOVELINEEND_IMPL(ImGuiInputTextState* obj, ImStb::STB_Te
 
 #define STB_TEXTEDIT_MOVELINESTART      STB_TEXTEDIT_MOVELINESTART_IMPL
 #define STB_TEXTEDIT_MOVELINEEND        STB_TEXTEDIT_MOVELINEEND_IMPL
+#define IMSTB_TEXTEDIT_FINDROWFROMCHAR  InputTextLineIndexFindRowFromChar
+#define IMSTB_TEXTEDIT_FINDROWFROMY     InputTextLineIndexFindRowFromY
 
 static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
     // Offset remaining text (+ copy zero terminator)
     IM_ASSERT(obj->TextSrc == obj->TextA.Data);
+    InputTextCaptureRevertValue(obj, NULL);
+    int paragraph_start = 0, paragraph_end = 0;
+    const bool update_line_index = obj->LineIndexValid && InputTextLineIndexIsValid(obj, obj->WrapWidth);
+    if (update_line_index)
+        InputTextLineIndexFindParagraph(obj, pos, pos + n, &paragraph_start, &paragraph_end);
+    InputTextMarkDirty(obj, pos, n, obj->TextLen);
+    InputTextUndoRecordEdit(obj, pos, obj->TextA.Data + pos, n, NULL, 0);
     char* dst = obj->TextA.Data + pos;
     char* src = obj->TextA.Data + pos + n;
     memmove(dst, src, obj->TextLen - n - pos + 1);
     obj->EditedBefore = obj->EditedThisFrame = true;
     obj->TextLen -= n;
+    if (update_line_index)
+        InputTextLineIndexUpdate(obj, paragraph_start, paragraph_end, (paragraph_end == INT_MAX) ? INT_MAX : paragraph_end - n, -n);
+    else
+        obj->LineIndexValid = false;
 }
 
 static int STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const char* new_text, int new_text_len)
@@ -4221,12 +4538,14 @@ static int STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const cha
 
     // Grow internal buffer if needed
     IM_ASSERT(obj->TextSrc == obj->TextA.Data);
+    InputTextCaptureRevertValue(obj, NULL);
     if (text_len + new_text_len + 1 > obj->TextA.Size && is_resizable)
     {
         obj->TextA.resize(text_len + ImClamp(new_text_len, 32, ImMax(256, new_text_len)) + 1);
         obj->TextSrc = obj->TextA.Data;
     }
 
+    InputTextMarkDirty(obj, pos, 0, text_len);
     char* text = obj->TextA.Data;
     if (pos != text_len)
         memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos));
@@ -4235,6 +4554,18 @@ static int STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const cha
     obj->EditedBefore = obj->EditedThisFrame = true;
     obj->TextLen += new_text_len;
     obj->TextA[obj->TextLen] = '\0';
+    InputTextUndoRecordEdit(obj, pos, NULL, 0, new_text, new_text_len);
+
+    if (obj->LineIndexValid && InputTextLineIndexIsValid(obj, obj->WrapWidth))
+    {
+        int paragraph_start, paragraph_end;
+        InputTextLineIndexFindParagraph(obj, pos, pos + new_text_len, &paragraph_start, &paragraph_end);
+        InputTextLineIndexUpdate(obj, paragraph_start, (paragraph_end == INT_MAX) ? INT_MAX : paragraph_end - new_text_len, paragraph_end, new_text_len);
+    }
+    else
+    {
+        obj->LineIndexValid = false;
+    }
 
     return new_text_len;
 }
@@ -4289,6 +4620,8 @@ ImGuiInputTextState::ImGuiInputTextState()
     memset((void*)this, 0, sizeof(*this));
     Stb = IM_NEW(ImStbTexteditState);
     memset(Stb, 0, sizeof(*Stb));
+    CallbackTextBackupDirty.Invalidate();
+    UserBufDirty.Invalidate();
 }
 
 ImGuiInputTextState::~ImGuiInputTextState()
@@ -4298,10 +4631,28 @@ ImGuiInputTextState::~ImGuiInputTextState()
 
 void ImGuiInputTextState::OnKeyPressed(int key)
 {
-    stb_textedit_key(this, Stb, key);
+    const int key_u = (key & ~STB_TEXTEDIT_K_SHIFT);
+    if (key == STB_TEXTEDIT_K_UNDO || key == STB_TEXTEDIT_K_REDO)
+        ClearExtraCarets();
+    if ((key == STB_TEXTEDIT_K_UNDO || key == STB_TEXTEDIT_K_REDO) && UndoHistory.MemoryBudget > 0)
+    {
+        InputTextUndoApply(this, key == STB_TEXTEDIT_K_REDO);
+        Stb->has_preferred_x = 0;
+    }
+    else if (ExtraCarets.Size > 0 && (key_u == STB_TEXTEDIT_K_BACKSPACE || key_u == STB_TEXTEDIT_K_DELETE))
+    {
+        InputTextMultiCaretEdit(this, key_u, NULL, 0, false);
+    }
+    else if (ExtraCarets.Size > 0)
+    {
+        InputTextMultiCaretKey(this, key);
+    }
+    else
+    {
+        stb_textedit_key(this, Stb, key);
+    }
     CursorFollow = true;
     CursorAnimReset();
-    const int key_u = (key & ~STB_TEXTEDIT_K_SHIFT);
     if (key_u == STB_TEXTEDIT_K_LEFT || key_u == STB_TEXTEDIT_K_LINESTART || key_u == STB_TEXTEDIT_K_TEXTSTART || key_u == STB_TEXTEDIT_K_BACKSPACE || key_u == STB_TEXTEDIT_K_WORDLEFT)
         LastMoveDirectionLR = ImGuiDir_Left;
     else if (key_u == STB_TEXTEDIT_K_RIGHT || key_u == STB_TEXTEDIT_K_LINEEND || key_u == STB_TEXTEDIT_K_TEXTEND || key_u == STB_TEXTEDIT_K_DELETE || key_u == STB_TEXTEDIT_K_WORDRIGHT)
@@ -4314,14 +4665,17 @@ void ImGuiInputTextState::OnCharPressed(unsigned int c)
     // The changes we had to make to stb_textedit_key made it very much UTF-8 specific which is not too great.
     char utf8[5];
     ImTextCharToUtf8(utf8, c);
-    stb_textedit_text(this, Stb, utf8, (int)ImStrlen(utf8));
+    if (ExtraCarets.Size > 0)
+        InputTextMultiCaretEdit(this, 0, utf8, (int)ImStrlen(utf8), false);
+    else
+        stb_textedit_text(this, Stb, utf8, (int)ImStrlen(utf8));
     CursorFollow = true;
     CursorAnimReset();
 }
 
 // Those functions are not inlined in imgui_internal.h, allowing us to hide ImStbTexteditState from that header.
 void ImGuiInputTextState::CursorAnimReset()                 { CursorAnim = -0.30f; } // After a user-input the cursor stays on for a while without blinking
-void ImGuiInputTextState::CursorClamp()                     { Stb->cursor = ImMin(Stb->cursor, TextLen); Stb->select_start = ImMin(Stb->select_start, TextLen); Stb->select_end = ImMin(Stb->select_end, TextLen); }
+void ImGuiInputTextState::CursorClamp()                     { Stb->cursor = ImMin(Stb->cursor, TextLen); Stb->select_start = ImMin(Stb->select_start, TextLen); Stb->select_end = ImMin(Stb->select_end, TextLen); for (ImGuiInputTextCaret& caret : ExtraCarets) { caret.Cursor = ImMin(caret.Cursor, TextLen); caret.SelectStart = ImMin(caret.SelectStart, TextLen); caret.SelectEnd = ImMin(caret.SelectEnd, TextLen); } InputTextMultiCaretNormalize(this); }
 bool ImGuiInputTextState::HasSelection() const              { return Stb->select_start != Stb->select_end; }
 void ImGuiInputTextState::ClearSelection()                  { Stb->select_start = Stb->select_end = Stb->cursor; }
 int  ImGuiInputTextState::GetCursorPos() const              { return Stb->cursor; }
@@ -4329,7 +4683,7 @@ int  ImGuiInputTextState::GetSelectionStart() const         { return Stb->select
 int  ImGuiInputTextState::GetSelectionEnd() const           { return Stb->select_end; }
 void ImGuiInputTextState::SetSelection(int start, int end)  { Stb->select_start = start; Stb->cursor = Stb->select_end = end; }
 float ImGuiInputTextState::GetPreferredOffsetX() const      { return Stb->has_preferred_x ? Stb->preferred_x : -1; }
-void ImGuiInputTextState::SelectAll()                       { Stb->select_start = 0; Stb->cursor = Stb->select_end = TextLen; Stb->has_preferred_x = 0; }
+void ImGuiInputTextState::SelectAll()                       { Stb->select_start = 0; Stb->cursor = Stb->select_end = TextLen; Stb->has_preferred_x = 0; ClearExtraCarets(); }
 void ImGuiInputTextState::ReloadUserBufAndSelectAll()       { WantReloadUserBuf = true; ReloadSelectionStart = 0; ReloadSelectionEnd = INT_MAX; }
 void ImGuiInputTextState::ReloadUserBufAndKeepSelection()   { WantReloadUserBuf = true; ReloadSelectionStart = Stb->select_start; ReloadSelectionEnd = Stb->select_end; }
 void ImGuiInputTextState::ReloadUserBufAndMoveToEnd()       { WantReloadUserBuf = true; ReloadSelectionStart = ReloadSelectionEnd = INT_MAX; }
@@ -4346,6 +4700,9 @@ ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 void ImGuiInputTextCallbackData::DeleteChars(int pos, int bytes_count)
 {
     IM_ASSERT(pos + bytes_count <= BufTextLen);
+    ImGuiInputTextState* obj = Ctx ? &Ctx->InputTextState : NULL;
+    if (obj && obj->ID == ID && Buf == obj->TextA.Data)
+        InputTextMarkDirty(obj, pos, bytes_count, BufTextLen);
     char* dst = Buf + pos;
     const char* src = Buf + pos + bytes_count;
     memmove(dst, src, BufTextLen - bytes_count - pos + 1);
@@ -4390,6 +4747,8 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
         BufSize = obj->BufCapacity = new_buf_size;
     }
 
+    if (obj->ID == ID && Buf == obj->TextA.Data)
+        InputTextMarkDirty(obj, pos, 0, BufTextLen);
     if (BufTextLen != pos)
         memmove(Buf + pos + new_text_len, Buf + pos, (size_t)(BufTextLen - pos));
     memcpy(Buf + pos, new_text, (size_t)new_text_len * sizeof(char));
@@ -4548,165 +4907,1164 @@ static bool InputTextFilterCharacter(ImGuiContext* ctx, ImGuiInputTextState* sta
 // Find the shortest single replacement we can make to get from old_buf to new_buf
 // Note that this doesn't directly alter state->TextA, state->TextLen. They are expected to be made valid separately.
 // FIXME: Ideally we should transition toward (1) making InsertChars()/DeleteChars() update undo-stack (2) discourage (and keep reconcile) or obsolete (and remove reconcile) accessing buffer directly.
-static void InputTextReconcileUndoState(ImGuiInputTextState* state, const char* old_buf, int old_length, const char* new_buf, int new_length)
+// 'known_same_prefix'/'known_same_suffix' are optional number of bytes known to be identical at the beginning/end of both buffers, to avoid scanning them.
+static void InputTextReconcileUndoState(ImGuiInputTextState* state, const char* old_buf, int old_length, const char* new_buf, int new_length, int known_same_prefix, int known_same_suffix)
 {
     const int shorter_length = ImMin(old_length, new_length);
     int first_diff;
-    for (first_diff = 0; first_diff < shorter_length; first_diff++)
+    for (first_diff = ImMin(known_same_prefix, shorter_length); first_diff < shorter_length; first_diff++)
         if (old_buf[first_diff] != new_buf[first_diff])
             break;
     if (first_diff == old_length && first_diff == new_length)
         return;
 
-    int old_last_diff = old_length   - 1;
-    int new_last_diff = new_length - 1;
+    known_same_suffix = ImMin(known_same_suffix, shorter_length - first_diff);
+    int old_last_diff = old_length - 1 - known_same_suffix;
+    int new_last_diff = new_length - 1 - known_same_suffix;
     for (; old_last_diff >= first_diff && new_last_diff >= first_diff; old_last_diff--, new_last_diff--)
         if (old_buf[old_last_diff] != new_buf[new_last_diff])
             break;
 
     const int insert_len = new_last_diff - first_diff + 1;
     const int delete_len = old_last_diff - first_diff + 1;
-    if (insert_len > 0 || delete_len > 0)
+    if (state->UndoHistory.MemoryBudget > 0)
+        InputTextUndoRecordEdit(state, first_diff, old_buf + first_diff, delete_len, new_buf + first_diff, insert_len);
+    else if (insert_len > 0 || delete_len > 0)
         if (IMSTB_TEXTEDIT_CHARTYPE* p = stb_text_createundo(&state->Stb->undostate, first_diff, delete_len, insert_len))
             for (int i = 0; i < delete_len; i++)
                 p[i] = old_buf[first_diff + i];
 }
 
-// As InputText() retain textual data and we currently provide a path for user to not retain it (via local variables)
-// we need some form of hook to reapply data back to user buffer on deactivation frame. (#4714)
-// It would be more desirable that we discourage users from taking advantage of the "user not retaining data" trick,
-// but that more likely be attractive when we do have _NoLiveEdit flag available.
-void ImGui::InputTextDeactivateHook(ImGuiID id)
+// Capture the value to revert to when pressing Escape. This is done lazily before the first modification of TextA,
+// so activating a large text field doesn't copy it twice. 'text_backup' may provide a copy of the unmodified text that we can steal.
+static void InputTextCaptureRevertValue(ImGuiInputTextState* state, ImVector<char>* text_backup)
 {
-    ImGuiContext& g = *GImGui;
-    ImGuiInputTextState* state = &g.InputTextState;
-    if (id == 0 || state->ID != id)
+    if (!state->TextToRevertToPending)
         return;
-    g.InputTextDeactivatedState.ID = state->ID;
-    if (state->Flags & ImGuiInputTextFlags_ReadOnly)
+    state->TextToRevertToPending = false;
+    if (state->Flags & ImGuiInputTextFlags_NoLiveEdit)
     {
-        g.InputTextDeactivatedState.TextA.resize(0); // In theory this data won't be used, but clear to be neat.
+        state->TextToRevertTo.resize(0); // User buffer is left untouched while active: revert from it.
+    }
+    else if (text_backup != NULL)
+    {
+        state->TextToRevertTo.swap(*text_backup);
     }
     else
     {
-        IM_ASSERT(state->TextA.Data != 0);
-        IM_ASSERT(state->TextA[state->TextLen] == 0);
-        g.InputTextDeactivatedState.TextA.resize(state->TextLen + 1);
-        memcpy(g.InputTextDeactivatedState.TextA.Data, state->TextA.Data, state->TextLen + 1);
+        state->TextToRevertTo.resize(state->TextLen + 1);
+        memcpy(state->TextToRevertTo.Data, state->TextA.Data, state->TextLen + 1);
     }
 }
 
-static int* ImLowerBound(int* in_begin, int* in_end, int v)
+// Record a modification of TextA, so that copies of it (user buffer, CallbackTextBackup) can be updated by only copying what changed.
+static void InputTextMarkDirty(ImGuiInputTextState* state, int pos, int removed_len, int text_len_before)
 {
-    int* in_p = in_begin;
-    for (size_t count = (size_t)(in_end - in_p); count > 0; )
+    state->UserBufDirty.AddEdit(pos, removed_len, text_len_before);
+    state->CallbackTextBackupDirty.AddEdit(pos, removed_len, text_len_before);
+}
+
+// Update 'dst' (a copy of 'src' made at the time 'dirty' was reset) so it matches 'src' again. Only copy the modified part.
+// 'dst' must have room for 'src_len + 1' bytes and have been kept unmodified, or 'dirty' invalidated.
+static void InputTextCopyDirtyRange(char* dst, const char* src, int src_len, const ImGuiTextDirtyRange& dirty)
+{
+    if (!dirty.IsValid())
+        memcpy(dst, src, (size_t)src_len + 1);
+    else if (dirty.RefLen == src_len)
+        memcpy(dst + dirty.Begin, src + dirty.Begin, (size_t)(src_len - dirty.TailLen - dirty.Begin));
+    else
+        memcpy(dst + dirty.Begin, src + dirty.Begin, (size_t)(src_len - dirty.Begin) + 1); // Length changed: tail moved
+}
+
+// Minimal LZ77 compression for undo data (we favor speed and simplicity over ratio): a sequence of
+// [literals count][literals][match length - 4][match distance], with counts stored as variable-length integers. The last sequence has no match.
+// Returns compressed size, or -1 when not worth it (output would be larger than 7/8 of input).
+static char* ImTextUndoWriteVarint(char* dst, unsigned int v)
+{
+    while (v >= 0x80)
     {
-        size_t count2 = count >> 1;
-        int* mid = in_p + count2;
-        if (*mid < v)
-        {
-            in_p = ++mid;
-            count -= count2 + 1;
-        }
-        else
-        {
-            count = count2;
-        }
+        *dst++ = (char)(v | 0x80);
+        v >>= 7;
     }
-    return in_p;
+    *dst++ = (char)v;
+    return dst;
 }
 
-// FIXME-WORDWRAP: Bundle some of this into ImGuiTextIndex and/or extract as a different tool?
-// 'max_output_buffer_size' happens to be a meaningful optimization to avoid writing the full line_index when not necessarily needed (e.g. very large buffer, scrolled up, inactive)
-static int InputTextLineIndexBuild(ImGuiInputTextFlags flags, ImGuiTextIndex* line_index, const char* buf, const char* buf_end, float wrap_width, int max_output_buffer_size, const char** out_buf_end)
+static const char* ImTextUndoReadVarint(const char* src, unsigned int* out_v)
 {
-    ImGuiContext& g = *GImGui;
-    int size = 0;
-    const char* s;
-    bool trailing_line_already_counted = false;
-    if (flags & ImGuiInputTextFlags_WordWrap)
+    unsigned int v = 0;
+    for (int shift = 0; ; shift += 7)
     {
-        for (s = buf; s < buf_end; s = (*s == '\n') ? s + 1 : s)
-        {
-            if (size++ <= max_output_buffer_size)
-                line_index->Offsets.push_back((int)(s - buf));
-            s = ImFontCalcWordWrapPositionEx(g.Font, g.FontSize, s, buf_end, wrap_width, ImDrawTextFlags_WrapKeepBlanks);
-        }
+        const unsigned char c = (unsigned char)*src++;
+        v |= (unsigned int)(c & 0x7F) << shift;
+        if ((c & 0x80) == 0)
+            break;
     }
-    else if (buf_end != NULL)
+    *out_v = v;
+    return src;
+}
+
+static int InputTextUndoCompress(const char* src, int src_len, ImVector<char>* out_buf)
+{
+    const int HASH_BITS = 12;
+    int hash_table[1 << HASH_BITS];
+    for (int n = 0; n < IM_COUNTOF(hash_table); n++)
+        hash_table[n] = -1;
+
+    const int dst_max = src_len - src_len / 8;
+    out_buf->resize(src_len + 32);
+    char* dst = out_buf->Data;
+    int literals_start = 0;
+    int i = 0;
+    while (i + 4 <= src_len)
     {
-        for (s = buf; s < buf_end; s = s ? s + 1 : buf_end)
+        ImU32 seq;
+        memcpy(&seq, src + i, 4);
+        const ImU32 hash = (seq * 2654435761u) >> (32 - HASH_BITS);
+        const int match_pos = hash_table[hash];
+        hash_table[hash] = i;
+        if (match_pos < 0 || memcmp(src + match_pos, src + i, 4) != 0)
         {
-            if (size++ <= max_output_buffer_size)
-                line_index->Offsets.push_back((int)(s - buf));
-            s = (const char*)ImMemchr(s, '\n', buf_end - s);
+            i++;
+            continue;
         }
+        int match_len = 4;
+        while (i + match_len < src_len && src[match_pos + match_len] == src[i + match_len])
+            match_len++;
+        const int literals_count = i - literals_start;
+        if ((int)(dst - out_buf->Data) + literals_count + 15 > dst_max)
+            return -1;
+        dst = ImTextUndoWriteVarint(dst, (unsigned int)literals_count);
+        memcpy(dst, src + literals_start, (size_t)literals_count);
+        dst += literals_count;
+        dst = ImTextUndoWriteVarint(dst, (unsigned int)(match_len - 4));
+        dst = ImTextUndoWriteVarint(dst, (unsigned int)(i - match_pos));
+        i += match_len;
+        literals_start = i;
+    }
+    const int literals_count = src_len - literals_start;
+    if ((int)(dst - out_buf->Data) + literals_count + 5 > dst_max)
+        return -1;
+    dst = ImTextUndoWriteVarint(dst, (unsigned int)literals_count);
+    memcpy(dst, src + literals_start, (size_t)literals_count);
+    dst += literals_count;
+    return (int)(dst - out_buf->Data);
+}
+
+static void InputTextUndoDecompress(const char* src, int src_size, char* dst, int dst_len)
+{
+    const char* src_end = src + src_size;
+    char* dst_begin = dst;
+    while (src < src_end)
+    {
+        unsigned int literals_count, match_len, match_dist;
+        src = ImTextUndoReadVarint(src, &literals_count);
+        memcpy(dst, src, literals_count);
+        src += literals_count;
+        dst += literals_count;
+        if (src >= src_end)
+            break;
+        src = ImTextUndoReadVarint(src, &match_len);
+        src = ImTextUndoReadVarint(src, &match_dist);
+        const char* match_src = dst - match_dist;
+        for (unsigned int n = 0; n < match_len + 4; n++) // Byte per byte as ranges may overlap
+            *dst++ = *match_src++;
     }
-    else
+    IM_ASSERT(dst == dst_begin + dst_len);
+    IM_UNUSED(dst_begin);
+    IM_UNUSED(dst_len);
+}
+
+// Set Where/RemoveLen/InsertLen of a multi-caret record to the span covered by its ranges
+static void InputTextUndoRangesGetSpan(const ImGuiInputTextUndoRange* ranges, int ranges_count, ImGuiInputTextUndoRecord* rec)
+{
+    const ImGuiInputTextUndoRange& first = ranges[0];
+    const ImGuiInputTextUndoRange& last = ranges[ranges_count - 1];
+    rec->Where = first.Where;
+    rec->RemoveLen = rec->InsertLen = last.Where + last.RemoveLen - first.Where;
+    for (int n = 0; n < ranges_count; n++)
+        rec->InsertLen += ranges[n].InsertLen - ranges[n].RemoveLen;
+}
+
+// Push a record on an undo/redo stack, storing (and possibly compressing) 'insert_len' bytes of 'insert_text'.
+// Return NULL and clear the stack if the record alone doesn't fit in the memory budget: history can't go past this step.
+static ImGuiInputTextUndoRecord* InputTextUndoStackPush(ImGuiInputTextUndoHistory* history, ImGuiInputTextUndoStack* stack, int where, int remove_len, const char* insert_text, int insert_len)
+{
+    ImGuiInputTextUndoRecord rec;
+    rec.Where = where;
+    rec.RemoveLen = remove_len;
+    rec.InsertLen = insert_len;
+    rec.DataSize = insert_len;
+    rec.RangesCount = 0;
+    rec.Compressed = rec.Sealed = false;
+    const int COMPRESS_MIN_SIZE = 1024;
+    if (history->Compress && insert_len >= COMPRESS_MIN_SIZE && insert_len / 16 < history->MemoryBudget)
     {
-        // Inactive path: we don't know buf_end ahead of time.
-        const char* s_eol;
-        for (s = buf; ; s = s_eol + 1)
+        const int compressed_size = InputTextUndoCompress(insert_text, insert_len, &history->TempBuffer);
+        if (compressed_size >= 0)
         {
-            if (size++ <= max_output_buffer_size)
-                line_index->Offsets.push_back((int)(s - buf));
-            if ((s_eol = strchr(s, '\n')) != NULL)
-                continue;
-            s += strlen(s);
-            trailing_line_already_counted = true;
-            break;
+            insert_text = history->TempBuffer.Data;
+            rec.DataSize = compressed_size;
+            rec.Compressed = rec.Sealed = true;
         }
     }
-    if (out_buf_end != NULL)
-        *out_buf_end = buf_end = s;
-    if (size == 0)
+    if (rec.DataSize + (int)sizeof(ImGuiInputTextUndoRecord) > history->MemoryBudget)
     {
-        line_index->Offsets.push_back(0);
-        size++;
+        stack->clear();
+        return NULL;
     }
-    if (buf_end > buf && buf_end[-1] == '\n' && !trailing_line_already_counted && size++ <= max_output_buffer_size)
-        line_index->Offsets.push_back((int)(buf_end - buf));
-    return size;
+    rec.DataOffset = stack->Data.Size;
+    if (rec.DataSize > 0)
+    {
+        stack->Data.resize(stack->Data.Size + rec.DataSize);
+        memcpy(stack->Data.Data + rec.DataOffset, insert_text, (size_t)rec.DataSize);
+    }
+    stack->Records.push_back(rec);
+    return &stack->Records.back();
 }
 
-static ImVec2 InputTextLineIndexGetPosOffset(ImGuiContext& g, ImGuiInputTextState* state, ImGuiTextIndex* line_index, const char* buf, const char* buf_end, int cursor_n)
+// Push a multi-caret record: 'ranges' followed by the concatenated inserted bytes of each range. Never compressed.
+static ImGuiInputTextUndoRecord* InputTextUndoStackPushRanges(ImGuiInputTextUndoHistory* history, ImGuiInputTextUndoStack* stack, const ImGuiInputTextUndoRange* ranges, int ranges_count, const char* insert_text, int insert_len)
 {
-    const char* cursor_ptr = buf + cursor_n;
-    int* it_begin = line_index->Offsets.begin();
-    int* it_end = line_index->Offsets.end();
-    const int* it = ImLowerBound(it_begin, it_end, cursor_n);
-    if (it > it_begin)
-        if (it == it_end || *it != cursor_n || (state != NULL && state->WrapWidth > 0.0f && state->LastMoveDirectionLR == ImGuiDir_Right && cursor_ptr[-1] != '\n' && cursor_ptr[-1] != 0))
-            it--;
+    IM_ASSERT(ranges_count > 0);
+    const int ranges_size = ranges_count * (int)sizeof(ImGuiInputTextUndoRange);
+    if (ranges_size + insert_len + (int)sizeof(ImGuiInputTextUndoRecord) > history->MemoryBudget)
+    {
+        stack->clear();
+        return NULL;
+    }
+    ImGuiInputTextUndoRecord rec;
+    InputTextUndoRangesGetSpan(ranges, ranges_count, &rec);
+    rec.DataOffset = stack->Data.Size;
+    rec.DataSize = ranges_size + insert_len;
+    rec.RangesCount = ranges_count;
+    rec.Compressed = rec.Sealed = false;
+    stack->Data.resize(stack->Data.Size + rec.DataSize);
+    memcpy(stack->Data.Data + rec.DataOffset, ranges, (size_t)ranges_size);
+    if (insert_len > 0)
+        memcpy(stack->Data.Data + rec.DataOffset + ranges_size, insert_text, (size_t)insert_len);
+    stack->Records.push_back(rec);
+    return &stack->Records.back();
+}
 
-    const int line_no = (it == it_begin) ? 0 : line_index->Offsets.index_from_ptr(it);
-    const char* line_start = line_index->get_line_begin(buf, line_no);
-    ImVec2 offset;
-    offset.x = InputTextCalcTextSize(&g, line_start, cursor_ptr, buf_end, NULL, NULL, ImDrawTextFlags_WrapKeepBlanks).x;
-    offset.y = (line_no + 1) * g.FontSize;
-    return offset;
+static void InputTextUndoStackPop(ImGuiInputTextUndoStack* stack)
+{
+    IM_ASSERT(stack->GetCount() > 0);
+    stack->Data.resize(stack->Records.back().DataOffset);
+    stack->Records.pop_back();
+    if (stack->GetCount() == 0)
+        stack->clear();
 }
 
-// Edit a string of text
-// - buf_size account for the zero-terminator, so a buf_size of 6 can hold "Hello" but not "Hello!".
-//   This is so we can easily call InputText() on static arrays using ARRAYSIZE() and to match
-//   Note that in std::string world, capacity() would omit 1 byte used by the zero-terminator.
-// - When active, hold on a privately held copy of the text (and apply back to 'buf'). So changing 'buf' while the InputText is active has no effect.
-// - If you want to use InputText() with std::string or any custom dynamic string type, use the wrapper in misc/cpp/imgui_stdlib.h/.cpp!
-bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
+static void InputTextUndoStackDiscardOldest(ImGuiInputTextUndoStack* stack)
 {
-    ImGuiWindow* window = GetCurrentWindow();
-    if (window->SkipItems)
-        return false;
+    IM_ASSERT(stack->GetCount() > 0);
+    const ImGuiInputTextUndoRecord& rec = stack->Records[stack->RecordsHead++];
+    stack->DataHead = rec.DataOffset + rec.DataSize;
+    if (stack->GetCount() == 0)
+    {
+        stack->clear();
+        return;
+    }
+    if (stack->RecordsHead * 2 <= stack->Records.Size && stack->DataHead * 2 <= stack->Data.Size)
+        return;
 
-    IM_ASSERT(buf != NULL && buf_size >= 0);
-    IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackHistory) && (flags & ImGuiInputTextFlags_Multiline)));        // Can't use both together (they both use up/down keys)
-    IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackCompletion) && (flags & ImGuiInputTextFlags_AllowTabInput))); // Can't use both together (they both use tab key)
-    IM_ASSERT(!((flags & ImGuiInputTextFlags_ElideLeft) && (flags & ImGuiInputTextFlags_Multiline)));              // Multiline does not not work with left-trimming
-    IM_ASSERT((flags & ImGuiInputTextFlags_WordWrap) == 0 || (flags & ImGuiInputTextFlags_Password) == 0);         // WordWrap does not work with Password mode.
-    IM_ASSERT((flags & ImGuiInputTextFlags_WordWrap) == 0 || (flags & ImGuiInputTextFlags_Multiline) != 0);        // WordWrap does not work in single-line mode.
+    // Compact storage
+    const int records_count = stack->GetCount();
+    const int data_size = stack->Data.Size - stack->DataHead;
+    memmove(stack->Records.Data, stack->Records.Data + stack->RecordsHead, (size_t)records_count * sizeof(ImGuiInputTextUndoRecord));
+    if (data_size > 0)
+        memmove(stack->Data.Data, stack->Data.Data + stack->DataHead, (size_t)data_size);
+    stack->Records.resize(records_count);
+    stack->Data.resize(data_size);
+    for (ImGuiInputTextUndoRecord& r : stack->Records)
+        r.DataOffset -= stack->DataHead;
+    stack->RecordsHead = stack->DataHead = 0;
+}
 
-    ImGuiContext& g = *GImGui;
+// Discard oldest undo steps, then farthest redo steps, until we are within memory budget.
+static void InputTextUndoTrim(ImGuiInputTextUndoHistory* history)
+{
+    while (history->GetMemoryUsage() > history->MemoryBudget)
+    {
+        if (history->UndoStack.GetCount() > 0)
+            InputTextUndoStackDiscardOldest(&history->UndoStack);
+        else if (history->RedoStack.GetCount() > 0)
+            InputTextUndoStackDiscardOldest(&history->RedoStack);
+        else
+            break;
+    }
+}
+
+// Record an edit into the undo history: 'deleted_len' bytes were removed at 'pos' then 'inserted_len' bytes were inserted.
+// Consecutive typing or erasing is coalesced into the same record, which is sealed at the end of a word.
+// Note that a large insertion (e.g. pasting) only stores its length, the inserted text itself is never copied.
+static void InputTextUndoRecordEdit(ImGuiInputTextState* state, int pos, const char* deleted_text, int deleted_len, const char* inserted_text, int inserted_len)
+{
+    ImGuiInputTextUndoHistory* history = &state->UndoHistory;
+    if (history->MemoryBudget <= 0 || history->Applying || (deleted_len == 0 && inserted_len == 0))
+        return;
+    history->RedoStack.clear();
+
+    ImGuiInputTextUndoStack* stack = &history->UndoStack;
+    ImGuiInputTextUndoRecord* rec = stack->back();
+    if (rec != NULL && (rec->Sealed || rec->RangesCount > 0))
+        rec = NULL;
+    if (rec != NULL && deleted_len == 0 && pos == rec->Where + rec->RemoveLen)
+    {
+        // Typing: extend inserted range
+        rec->RemoveLen += inserted_len;
+    }
+    else if (rec != NULL && inserted_len == 0 && pos >= rec->Where && pos + deleted_len == rec->Where + rec->RemoveLen)
+    {
+        // Erasing what was just typed
+        rec->RemoveLen -= deleted_len;
+        if (rec->RemoveLen == 0 && rec->InsertLen == 0)
+        {
+            InputTextUndoStackPop(stack);
+            rec = NULL;
+        }
+    }
+    else if (rec != NULL && inserted_len == 0 && rec->RemoveLen == 0 && (pos + deleted_len == rec->Where || pos == rec->Where))
+    {
+        // Backspace: prepend deleted text. Delete: append deleted text.
+        stack->Data.resize(stack->Data.Size + deleted_len);
+        char* data = stack->Data.Data + rec->DataOffset;
+        if (pos == rec->Where)
+        {
+            memcpy(data + rec->InsertLen, deleted_text, (size_t)deleted_len);
+        }
+        else
+        {
+            memmove(data + deleted_len, data, (size_t)rec->InsertLen);
+            memcpy(data, deleted_text, (size_t)deleted_len);
+            rec->Where = pos;
+        }
+        rec->InsertLen += deleted_len;
+        rec->DataSize += deleted_len;
+    }
+    else
+    {
+        rec = InputTextUndoStackPush(history, stack, pos, inserted_len, deleted_text, deleted_len);
+    }
+
+    // Seal at end of words, and after inserting more than one character at once (e.g. pasting)
+    if (rec != NULL)
+    {
+        const char c = (inserted_len > 0) ? inserted_text[inserted_len - 1] : deleted_text[0];
+        if (inserted_len > 1 || c == ' ' || c == '\t' || c == '\n')
+            rec->Sealed = true;
+    }
+    InputTextUndoTrim(history);
+}
+
+// Record a multi-caret edit from the ranges in history->TempRanges (positions in the edited text) and bytes each caret removed in history->TempBuffer.
+// Storage grows with the number of carets and changed bytes, not with the distance between carets.
+// Typing the same text at every caret is coalesced into the same record, as InputTextUndoRecordEdit() does for a single caret.
+static void InputTextUndoRecordRanges(ImGuiInputTextState* state, const char* inserted_text, int inserted_len)
+{
+    ImGuiInputTextUndoHistory* history = &state->UndoHistory;
+    const ImVector<ImGuiInputTextUndoRange>& ranges = history->TempRanges;
+    if (history->MemoryBudget <= 0 || history->Applying || ranges.Size == 0)
+        return;
+    history->RedoStack.clear();
+
+    ImGuiInputTextUndoStack* stack = &history->UndoStack;
+    ImGuiInputTextUndoRecord* rec = stack->back();
+    if (rec != NULL && (rec->Sealed || rec->RangesCount != ranges.Size))
+        rec = NULL;
+
+    // Typing: each caret inserted right after the text it inserted in previous record
+    char* rec_ranges = rec ? stack->Data.Data + rec->DataOffset : NULL;
+    int shift = 0;
+    for (int n = 0; rec != NULL && n < ranges.Size; n++)
+    {
+        ImGuiInputTextUndoRange rec_range;
+        memcpy(&rec_range, rec_ranges + n * sizeof(ImGuiInputTextUndoRange), sizeof(ImGuiInputTextUndoRange));
+        if (ranges[n].InsertLen != 0 || ranges[n].Where - shift != rec_range.Where + rec_range.RemoveLen)
+            rec = NULL;
+        shift += ranges[n].RemoveLen;
+    }
+    if (rec != NULL)
+    {
+        shift = 0;
+        for (int n = 0; n < ranges.Size; n++)
+        {
+            ImGuiInputTextUndoRange rec_range;
+            memcpy(&rec_range, rec_ranges + n * sizeof(ImGuiInputTextUndoRange), sizeof(ImGuiInputTextUndoRange));
+            rec_range.Where += shift;
+            rec_range.RemoveLen += ranges[n].RemoveLen;
+            shift += ranges[n].RemoveLen;
+            memcpy(rec_ranges + n * sizeof(ImGuiInputTextUndoRange), &rec_range, sizeof(ImGuiInputTextUndoRange));
+        }
+        rec->RemoveLen += shift;
+    }
+    else
+    {
+        rec = InputTextUndoStackPushRanges(history, stack, ranges.Data, ranges.Size, history->TempBuffer.Data, history->TempBuffer.Size);
+    }
+
+    // Seal at end of words, and after anything else than typing a single character
+    if (rec != NULL)
+    {
+        const char c = (inserted_len > 0) ? inserted_text[inserted_len - 1] : 0;
+        if (inserted_len != 1 || c == ' ' || c == '\t' || c == '\n')
+            rec->Sealed = true;
+    }
+    InputTextUndoTrim(history);
+}
+
+// Discard stb_textedit's own undo records, which become stale when text is modified by UndoHistory.
+static void InputTextStbUndoClear(ImStbTexteditState* stb)
+{
+    stb->undostate.undo_point = 0;
+    stb->undostate.undo_char_point = 0;
+    stb->undostate.redo_point = IMSTB_TEXTEDIT_UNDOSTATECOUNT;
+    stb->undostate.redo_char_point = IMSTB_TEXTEDIT_UNDOCHARCOUNT;
+}
+
+// stb_textedit undo can only record a multi-caret edit as one replacement of the whole span between first and last caret,
+// which is limited to IMSTB_TEXTEDIT_UNDOCHARCOUNT bytes. Switch to UndoHistory instead, moving existing stb_textedit steps to it.
+static void InputTextUndoEnableForMultiCaret(ImGuiInputTextState* state)
+{
+    ImGuiInputTextUndoHistory* history = &state->UndoHistory;
+    IM_ASSERT(history->MemoryBudget <= 0);
+    history->Clear();
+    history->MemoryBudget = INPUTTEXT_MULTICARET_UNDO_MEMORY_BUDGET;
+    history->EnabledByMultiCaret = true;
+
+    // Both use the same semantic: "at 'where', remove 'delete_length' bytes then insert 'insert_length' stored bytes".
+    // Undo records are stored oldest first from 0, redo records are stored oldest first from IMSTB_TEXTEDIT_UNDOSTATECOUNT - 1.
+    const ImStb::StbUndoState* undo_state = &state->Stb->undostate;
+    for (int n = 0; n < undo_state->undo_point; n++)
+    {
+        const ImStb::StbUndoRecord& r = undo_state->undo_rec[n];
+        if (ImGuiInputTextUndoRecord* rec = InputTextUndoStackPush(history, &history->UndoStack, r.where, r.delete_length, r.insert_length > 0 ? &undo_state->undo_char[r.char_storage] : NULL, r.insert_length))
+            rec->Sealed = true;
+    }
+    for (int n = IMSTB_TEXTEDIT_UNDOSTATECOUNT - 1; n >= undo_state->redo_point; n--)
+    {
+        const ImStb::StbUndoRecord& r = undo_state->undo_rec[n];
+        if (ImGuiInputTextUndoRecord* rec = InputTextUndoStackPush(history, &history->RedoStack, r.where, r.delete_length, r.insert_length > 0 ? &undo_state->undo_char[r.char_storage] : NULL, r.insert_length))
+            rec->Sealed = true;
+    }
+    InputTextStbUndoClear(state->Stb);
+}
+
+// Apply a multi-caret step with a single replacement of the text it spans, push its inverse on 'dst_stack', and put a caret at the end of each range.
+// Return false if the result doesn't fit a non-resizable buffer.
+static bool InputTextUndoApplyRanges(ImGuiInputTextState* state, ImGuiInputTextUndoStack* dst_stack, const ImGuiInputTextUndoRecord& op, const char* op_data)
+{
+    ImGuiInputTextUndoHistory* history = &state->UndoHistory;
+    const char* insert_text = op_data + op.RangesCount * sizeof(ImGuiInputTextUndoRange);
+    const char* text = state->TextA.Data;
+    ImVector<char>& out = state->MultiCaretBuffer;
+    ImVector<ImGuiInputTextUndoRange>& inv_ranges = history->TempRanges;
+    ImVector<char>& inv_text = history->TempBuffer;
+    out.resize(0);
+    inv_ranges.resize(0);
+    inv_text.resize(0);
+    int pos = op.Where;
+    int delta = 0;
+    for (int n = 0; n < op.RangesCount; n++)
+    {
+        ImGuiInputTextUndoRange range;
+        memcpy(&range, op_data + n * sizeof(ImGuiInputTextUndoRange), sizeof(ImGuiInputTextUndoRange));
+        const int keep_len = range.Where - pos;
+        out.resize(out.Size + keep_len + range.InsertLen);
+        if (keep_len > 0)
+            memcpy(out.Data + out.Size - keep_len - range.InsertLen, text + pos, (size_t)keep_len);
+        if (range.InsertLen > 0)
+            memcpy(out.Data + out.Size - range.InsertLen, insert_text, (size_t)range.InsertLen);
+        insert_text += range.InsertLen;
+
+        // Inverse range stores the text we are about to remove
+        ImGuiInputTextUndoRange inv_range;
+        inv_range.Where = range.Where + delta;
+        inv_range.RemoveLen = range.InsertLen;
+        inv_range.InsertLen = range.RemoveLen;
+        inv_ranges.push_back(inv_range);
+        inv_text.resize(inv_text.Size + range.RemoveLen);
+        if (range.RemoveLen > 0)
+            memcpy(inv_text.Data + inv_text.Size - range.RemoveLen, text + range.Where, (size_t)range.RemoveLen);
+        delta += range.InsertLen - range.RemoveLen;
+        pos = range.Where + range.RemoveLen;
+    }
+    IM_ASSERT(pos == op.Where + op.RemoveLen && out.Size == op.InsertLen);
+    const bool is_resizable = (state->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    if (!is_resizable && state->TextLen + delta > state->BufCapacity - 1)
+        return false;
+
+    if (ImGuiInputTextUndoRecord* rec = InputTextUndoStackPushRanges(history, dst_stack, inv_ranges.Data, inv_ranges.Size, inv_text.Data, inv_text.Size))
+        rec->Sealed = true;
+    InputTextReplaceChars(state, op.Where, op.RemoveLen, out.Data, out.Size);
+
+    state->ExtraCarets.resize(0);
+    for (const ImGuiInputTextUndoRange& inv_range : inv_ranges)
+    {
+        ImGuiInputTextCaret caret;
+        caret.Cursor = caret.SelectStart = caret.SelectEnd = inv_range.Where + inv_range.RemoveLen;
+        caret.PreferredX = -1.0f;
+        state->ExtraCarets.push_back(caret);
+    }
+    InputTextSetMainCaret(state, state->ExtraCarets.back());
+    state->ExtraCarets.pop_back();
+    InputTextMultiCaretNormalize(state);
+    return true;
+}
+
+// Apply top undo (or redo) step and push its inverse on the redo (or undo) stack.
+static void InputTextUndoApply(ImGuiInputTextState* state, bool is_redo)
+{
+    ImGuiInputTextUndoHistory* history = &state->UndoHistory;
+    ImGuiInputTextUndoStack* src_stack = is_redo ? &history->RedoStack : &history->UndoStack;
+    ImGuiInputTextUndoStack* dst_stack = is_redo ? &history->UndoStack : &history->RedoStack;
+    if (src_stack->GetCount() == 0)
+        return;
+    const ImGuiInputTextUndoRecord op = *src_stack->back();
+    if (op.Where + op.RemoveLen > state->TextLen)
+    {
+        // Text was modified without going through the history (should not happen)
+        history->Clear();
+        return;
+    }
+
+    if (op.RangesCount > 0)
+    {
+        if (!InputTextUndoApplyRanges(state, dst_stack, op, src_stack->Data.Data + op.DataOffset))
+        {
+            history->Clear();
+            return;
+        }
+    }
+    else
+    {
+        // Store the text we are about to remove in the inverse step
+        const bool has_inverse = InputTextUndoStackPush(history, dst_stack, op.Where, op.InsertLen, state->TextA.Data + op.Where, op.RemoveLen) != NULL;
+        const char* insert_text = src_stack->Data.Data + op.DataOffset;
+        if (op.Compressed)
+        {
+            history->TempBuffer.resize(op.InsertLen);
+            InputTextUndoDecompress(insert_text, op.DataSize, history->TempBuffer.Data, op.InsertLen);
+            insert_text = history->TempBuffer.Data;
+        }
+
+        history->Applying = true;
+        if (op.RemoveLen > 0)
+            ImStb::STB_TEXTEDIT_DELETECHARS(state, op.Where, op.RemoveLen);
+        const int inserted_len = (op.InsertLen > 0) ? ImStb::STB_TEXTEDIT_INSERTCHARS(state, op.Where, insert_text, op.InsertLen) : 0;
+        history->Applying = false;
+        if (has_inverse)
+        {
+            dst_stack->back()->RemoveLen = inserted_len; // Insertion may have been truncated
+            dst_stack->back()->Sealed = true;
+        }
+        state->Stb->cursor = op.Where + inserted_len;
+    }
+    InputTextUndoStackPop(src_stack);
+    if (ImGuiInputTextUndoRecord* rec = history->UndoStack.back())
+        rec->Sealed = true;
+    InputTextStbUndoClear(state->Stb);
+    InputTextUndoTrim(history);
+}
+
+// Multiple carets in a multi-line InputText()
+// - The main caret is stored in Stb (so stb_textedit and single-caret code paths are unaffected), others in state->ExtraCarets.
+// - Movements are applied to each caret in turn by swapping it into Stb.
+// - Edits are applied to all carets at once by InputTextMultiCaretEdit(): the text between first and last caret is rebuilt
+//   then replaced in a single pass over the buffer. Cost is O(text size + carets) per keystroke.
+// - Edits are recorded as a single multi-range undo step in UndoHistory, which is enabled by the first multi-caret edit if needed.
+static ImGuiInputTextCaret InputTextGetMainCaret(ImGuiInputTextState* state)
+{
+    ImStbTexteditState* stb = state->Stb;
+    ImGuiInputTextCaret caret;
+    caret.Cursor = stb->cursor;
+    caret.SelectStart = stb->select_start;
+    caret.SelectEnd = stb->select_end;
+    caret.PreferredX = stb->has_preferred_x ? stb->preferred_x : -1.0f;
+    return caret;
+}
+
+static void InputTextSetMainCaret(ImGuiInputTextState* state, const ImGuiInputTextCaret& caret)
+{
+    ImStbTexteditState* stb = state->Stb;
+    stb->cursor = caret.Cursor;
+    stb->select_start = caret.SelectStart;
+    stb->select_end = caret.SelectEnd;
+    stb->has_preferred_x = (caret.PreferredX >= 0.0f) ? 1 : 0;
+    stb->preferred_x = (caret.PreferredX >= 0.0f) ? caret.PreferredX : 0.0f;
+}
+
+static int IMGUI_CDECL InputTextCaretComparerByPos(const void* lhs, const void* rhs)
+{
+    const ImGuiInputTextCaret* a = (const ImGuiInputTextCaret*)lhs;
+    const ImGuiInputTextCaret* b = (const ImGuiInputTextCaret*)rhs;
+    return a->GetMin() - b->GetMin();
+}
+
+// Insert main caret into ExtraCarets at its sorted position, return its index. Undo with InputTextMultiCaretRemoveMain().
+static int InputTextMultiCaretInsertMain(ImGuiInputTextState* state)
+{
+    ImVector<ImGuiInputTextCaret>& carets = state->ExtraCarets;
+    const ImGuiInputTextCaret main_caret = InputTextGetMainCaret(state);
+    int main_n = 0;
+    while (main_n < carets.Size && carets[main_n].GetMin() < main_caret.GetMin())
+        main_n++;
+    carets.insert(carets.Data + main_n, main_caret);
+    return main_n;
+}
+
+static void InputTextMultiCaretRemoveMain(ImGuiInputTextState* state, int main_n)
+{
+    InputTextSetMainCaret(state, state->ExtraCarets[main_n]);
+    state->ExtraCarets.erase(state->ExtraCarets.Data + main_n);
+}
+
+// Sort carets and merge the ones which overlap or touch. A merged caret keeps the selection direction of its first caret.
+static void InputTextMultiCaretNormalize(ImGuiInputTextState* state)
+{
+    ImVector<ImGuiInputTextCaret>& carets = state->ExtraCarets;
+    if (carets.Size == 0)
+        return;
+    const int main_pos = InputTextGetMainCaret(state).GetMin();
+    carets.push_back(InputTextGetMainCaret(state));
+    ImQsort(carets.Data, (size_t)carets.Size, sizeof(ImGuiInputTextCaret), InputTextCaretComparerByPos);
+    int out_n = 0;
+    for (int n = 0; n < carets.Size; n++)
+    {
+        const ImGuiInputTextCaret caret = carets[n];
+        if (out_n > 0 && caret.GetMin() <= carets[out_n - 1].GetMax())
+        {
+            ImGuiInputTextCaret& prev = carets[out_n - 1];
+            const bool cursor_at_min = (prev.Cursor < prev.GetMax());
+            const int sel_min = prev.GetMin();
+            const int sel_max = ImMax(prev.GetMax(), caret.GetMax());
+            prev.SelectStart = cursor_at_min ? sel_max : sel_min;
+            prev.Cursor = prev.SelectEnd = cursor_at_min ? sel_min : sel_max;
+            prev.PreferredX = -1.0f;
+            continue;
+        }
+        carets[out_n++] = caret;
+    }
+    carets.resize(out_n);
+
+    // Merged carets don't touch each other, so exactly one of them contains the main caret
+    int main_n = 0;
+    while (main_n + 1 < carets.Size && carets[main_n].GetMax() < main_pos)
+        main_n++;
+    InputTextMultiCaretRemoveMain(state, main_n);
+}
+
+// Add a caret which becomes the main caret (Alt+Click)
+void ImGuiInputTextState::AddCaret(int select_start, int select_end)
+{
+    ExtraCarets.push_back(InputTextGetMainCaret(this));
+    ImGuiInputTextCaret caret;
+    caret.SelectStart = select_start;
+    caret.Cursor = caret.SelectEnd = select_end;
+    InputTextSetMainCaret(this, caret);
+    InputTextMultiCaretNormalize(this);
+    CursorFollow = true;
+    CursorAnimReset();
+}
+
+// Apply a cursor movement key to all carets
+static void InputTextMultiCaretKey(ImGuiInputTextState* state, int key)
+{
+    for (ImGuiInputTextCaret& caret : state->ExtraCarets)
+    {
+        const ImGuiInputTextCaret main_caret = InputTextGetMainCaret(state);
+        InputTextSetMainCaret(state, caret);
+        ImStb::stb_textedit_key(state, state->Stb, key);
+        caret = InputTextGetMainCaret(state);
+        InputTextSetMainCaret(state, main_caret);
+    }
+    ImStb::stb_textedit_key(state, state->Stb, key);
+    InputTextMultiCaretNormalize(state);
+}
+
+// Apply a selection key (e.g. STB_TEXTEDIT_K_WORDLEFT | STB_TEXTEDIT_K_SHIFT for Ctrl+Backspace) only to carets without a selection
+static void InputTextMultiCaretExtendEmptySelections(ImGuiInputTextState* state, int key)
+{
+    const int main_n = InputTextMultiCaretInsertMain(state);
+    for (ImGuiInputTextCaret& caret : state->ExtraCarets)
+    {
+        if (caret.SelectStart != caret.SelectEnd)
+            continue;
+        InputTextSetMainCaret(state, caret);
+        ImStb::stb_textedit_key(state, state->Stb, key);
+        caret = InputTextGetMainCaret(state);
+    }
+    InputTextMultiCaretRemoveMain(state, main_n);
+    InputTextMultiCaretNormalize(state);
+}
+
+// Add a caret on the row above/below the first/last caret, at the same horizontal position (Ctrl+Alt+Up/Down)
+static void InputTextMultiCaretAddVertical(ImGuiInputTextState* state, int key)
+{
+    const ImGuiInputTextCaret main_caret = InputTextGetMainCaret(state);
+    ImGuiInputTextCaret caret = main_caret;
+    if (state->ExtraCarets.Size > 0)
+    {
+        const ImGuiInputTextCaret& edge_caret = (key == STB_TEXTEDIT_K_UP) ? state->ExtraCarets.front() : state->ExtraCarets.back();
+        if ((key == STB_TEXTEDIT_K_UP) ? (edge_caret.GetMin() < caret.GetMin()) : (edge_caret.GetMin() > caret.GetMin()))
+            caret = edge_caret;
+    }
+    caret.SelectStart = caret.SelectEnd = caret.Cursor;
+    InputTextSetMainCaret(state, caret);
+    ImStb::stb_textedit_key(state, state->Stb, key);
+    if (state->Stb->cursor == caret.Cursor)
+    {
+        InputTextSetMainCaret(state, main_caret); // First or last row
+        return;
+    }
+    state->ExtraCarets.push_back(main_caret);
+    InputTextMultiCaretNormalize(state);
+    state->CursorFollow = true;
+    state->CursorAnimReset();
+}
+
+// Alt+Shift+Drag: one caret per row between 'anchor' and 'pos' (in text coordinates), selecting from anchor column to mouse column.
+static void InputTextMultiCaretBlockSelect(ImGuiInputTextState* state, const ImVec2& anchor, const ImVec2& pos)
+{
+    ImGuiContext& g = *state->Ctx;
+    const int row_max = state->LineIndexValid ? ImMax(state->LineIndex.Offsets.Size - 1, 0) : INT_MAX;
+    const int row_anchor = ImClamp((int)ImFloor(anchor.y / g.FontSize), 0, row_max);
+    const int row_pos = ImClamp((int)ImFloor(pos.y / g.FontSize), 0, row_max);
+    const int row_step = (row_pos >= row_anchor) ? +1 : -1;
+    state->ExtraCarets.resize(0);
+    for (int row = row_anchor; ; row += row_step)
+    {
+        const float y = (row + 0.5f) * g.FontSize;
+        int side_on_line;
+        ImGuiInputTextCaret caret;
+        caret.SelectStart = ImStb::stb_text_locate_coord(state, anchor.x, y, &side_on_line);
+        caret.Cursor = caret.SelectEnd = ImStb::stb_text_locate_coord(state, pos.x, y, &side_on_line);
+        if (row == row_pos)
+        {
+            InputTextSetMainCaret(state, caret);
+            break;
+        }
+        state->ExtraCarets.push_back(caret);
+    }
+    InputTextMultiCaretNormalize(state);
+    state->CursorFollow = true;
+    state->CursorAnimReset();
+}
+
+// Copy selected text of all carets into 'out', one line per selection
+static void InputTextMultiCaretGetSelectedText(ImGuiInputTextState* state, ImVector<char>* out)
+{
+    const int main_n = InputTextMultiCaretInsertMain(state);
+    out->resize(0);
+    for (const ImGuiInputTextCaret& caret : state->ExtraCarets)
+    {
+        if (caret.GetMin() == caret.GetMax())
+            continue;
+        if (out->Size > 0)
+            out->push_back('\n');
+        const int len = caret.GetMax() - caret.GetMin();
+        out->resize(out->Size + len);
+        memcpy(out->Data + out->Size - len, state->TextSrc + caret.GetMin(), (size_t)len);
+    }
+    out->push_back(0);
+    InputTextMultiCaretRemoveMain(state, main_n);
+}
+
+// Replace 'n' bytes at 'pos' with 'new_text' with a single move of the text that follows.
+// Caller is responsible for checking capacity and recording undo.
+static void InputTextReplaceChars(ImGuiInputTextState* obj, int pos, int n, const char* new_text, int new_text_len)
+{
+    IM_ASSERT(obj->TextSrc == obj->TextA.Data);
+    InputTextCaptureRevertValue(obj, NULL);
+    const int text_len = obj->TextLen;
+    const int delta = new_text_len - n;
+    int paragraph_start = 0, paragraph_end = 0;
+    const bool update_line_index = obj->LineIndexValid && InputTextLineIndexIsValid(obj, obj->WrapWidth);
+    if (update_line_index)
+        InputTextLineIndexFindParagraph(obj, pos, pos + n, &paragraph_start, &paragraph_end);
+    if (text_len + delta + 1 > obj->TextA.Size)
+    {
+        obj->TextA.resize(text_len + delta + ImClamp(delta, 32, ImMax(256, delta)) + 1);
+        obj->TextSrc = obj->TextA.Data;
+    }
+
+    InputTextMarkDirty(obj, pos, n, text_len);
+    char* text = obj->TextA.Data;
+    memmove(text + pos + new_text_len, text + pos + n, (size_t)(text_len - pos - n + 1)); // + zero terminator
+    memcpy(text + pos, new_text, (size_t)new_text_len);
+    obj->EditedBefore = obj->EditedThisFrame = true;
+    obj->TextLen += delta;
+    if (update_line_index)
+        InputTextLineIndexUpdate(obj, paragraph_start, paragraph_end, (paragraph_end == INT_MAX) ? INT_MAX : paragraph_end + delta, delta);
+    else
+        obj->LineIndexValid = false;
+}
+
+// Apply an edit to all carets: insert 'text' replacing selections (key == 0), or erase selections or one character (key == STB_TEXTEDIT_K_BACKSPACE/STB_TEXTEDIT_K_DELETE).
+// With 'distribute_lines', if 'text' has as many lines as there are carets, each caret gets one line (e.g. pasting a block selection).
+// Returns false when nothing was changed, or when the result wouldn't fit a non-resizable buffer.
+static bool InputTextMultiCaretEdit(ImGuiInputTextState* state, int key, const char* text, int text_len, bool distribute_lines)
+{
+    const int main_n = InputTextMultiCaretInsertMain(state);
+    ImVector<ImGuiInputTextCaret>& carets = state->ExtraCarets;
+    const char* src = state->TextA.Data;
+
+    const char* text_end = text + text_len;
+    if (distribute_lines)
+    {
+        int lines_count = 1;
+        for (const char* p = text; (p = (const char*)ImMemchr(p, '\n', (size_t)(text_end - p))) != NULL && p + 1 < text_end; p++)
+            lines_count++;
+        distribute_lines = (lines_count == carets.Size);
+    }
+
+    // First pass builds replacement for the [first caret, last caret] range, second pass moves carets and collects undo ranges (only once we know the edit can be applied)
+    ImVector<char>& out = state->MultiCaretBuffer;
+    out.resize(0);
+    ImGuiInputTextUndoHistory* history = &state->UndoHistory;
+    const bool is_resizable = (state->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    int range_begin = 0;
+    int range_end = 0;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        int out_len = 0;
+        const char* line = text;
+        for (int n = 0; n < carets.Size; n++)
+        {
+            ImGuiInputTextCaret& caret = carets[n];
+            int del_begin = caret.GetMin();
+            int del_end = caret.GetMax();
+            if (del_begin == del_end && key == STB_TEXTEDIT_K_BACKSPACE && del_begin > 0)
+                del_begin = ImStb::IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL(state, del_begin);
+            else if (del_begin == del_end && key == STB_TEXTEDIT_K_DELETE && del_end < state->TextLen)
+                del_end = ImStb::IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL(state, del_end);
+            if (n == 0)
+                range_begin = range_end = del_begin;
+            del_begin = ImMax(del_begin, range_end);
+            del_end = ImMax(del_end, del_begin);
+
+            const char* ins = text;
+            const char* ins_end = text_end;
+            if (distribute_lines)
+            {
+                const char* line_end = (const char*)ImMemchr(line, '\n', (size_t)(text_end - line));
+                ins = line;
+                ins_end = line_end ? line_end : text_end;
+                line = line_end ? line_end + 1 : text_end;
+            }
+            const int keep_len = del_begin - range_end;
+            const int ins_len = (int)(ins_end - ins);
+            if (pass == 0)
+            {
+                out.resize(out_len + keep_len + ins_len);
+                if (keep_len > 0)
+                    memcpy(out.Data + out_len, src + range_end, (size_t)keep_len);
+                if (ins_len > 0)
+                    memcpy(out.Data + out_len + keep_len, ins, (size_t)ins_len);
+            }
+            out_len += keep_len + ins_len;
+            if (pass == 1)
+            {
+                caret.Cursor = caret.SelectStart = caret.SelectEnd = range_begin + out_len;
+                caret.PreferredX = -1.0f;
+
+                // Undo range only stores the bytes removed by this caret
+                const int del_len = del_end - del_begin;
+                if (ins_len > 0 || del_len > 0)
+                {
+                    ImGuiInputTextUndoRange undo_range;
+                    undo_range.Where = caret.Cursor - ins_len;
+                    undo_range.RemoveLen = ins_len;
+                    undo_range.InsertLen = del_len;
+                    history->TempRanges.push_back(undo_range);
+                    history->TempBuffer.resize(history->TempBuffer.Size + del_len);
+                    if (del_len > 0)
+                        memcpy(history->TempBuffer.Data + history->TempBuffer.Size - del_len, src + del_begin, (size_t)del_len);
+                }
+            }
+            range_end = del_end;
+        }
+
+        if (pass == 0)
+        {
+            const int range_len = range_end - range_begin;
+            const bool no_change = (range_len == out.Size && memcmp(src + range_begin, out.Data, (size_t)out.Size) == 0);
+            if (no_change || (!is_resizable && state->TextLen - range_len + out.Size > state->BufCapacity - 1))
+            {
+                InputTextMultiCaretRemoveMain(state, main_n);
+                return false;
+            }
+            if (history->MemoryBudget <= 0)
+                InputTextUndoEnableForMultiCaret(state);
+            history->TempRanges.resize(0);
+            history->TempBuffer.resize(0);
+        }
+    }
+    const int range_len = range_end - range_begin;
+
+    // Record a single undo step, then apply
+    InputTextUndoRecordRanges(state, text, text_len);
+    InputTextReplaceChars(state, range_begin, range_len, out.Data, out.Size);
+    InputTextMultiCaretRemoveMain(state, main_n);
+    InputTextMultiCaretNormalize(state);
+    return true;
+}
+
+// As InputText() retain textual data and we currently provide a path for user to not retain it (via local variables)
+// we need some form of hook to reapply data back to user buffer on deactivation frame. (#4714)
+// It would be more desirable that we discourage users from taking advantage of the "user not retaining data" trick,
+// but that more likely be attractive when we do have _NoLiveEdit flag available.
+void ImGui::InputTextDeactivateHook(ImGuiID id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputTextState* state = &g.InputTextState;
+    if (id == 0 || state->ID != id)
+        return;
+    g.InputTextDeactivatedState.ID = state->ID;
+    if (state->Flags & ImGuiInputTextFlags_ReadOnly)
+    {
+        g.InputTextDeactivatedState.TextA.resize(0); // In theory this data won't be used, but clear to be neat.
+    }
+    else
+    {
+        IM_ASSERT(state->TextA.Data != 0);
+        IM_ASSERT(state->TextA[state->TextLen] == 0);
+        g.InputTextDeactivatedState.TextA.resize(state->TextLen + 1);
+        memcpy(g.InputTextDeactivatedState.TextA.Data, state->TextA.Data, state->TextLen + 1);
+    }
+}
+
+static int* ImLowerBound(int* in_begin, int* in_end, int v)
+{
+    int* in_p = in_begin;
+    for (size_t count = (size_t)(in_end - in_p); count > 0; )
+    {
+        size_t count2 = count >> 1;
+        int* mid = in_p + count2;
+        if (*mid < v)
+        {
+            in_p = ++mid;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return in_p;
+}
+
+// FIXME-WORDWRAP: Bundle some of this into ImGuiTextIndex and/or extract as a different tool?
+// 'max_output_buffer_size' happens to be a meaningful optimization to avoid writing the full line_index when not necessarily needed (e.g. very large buffer, scrolled up, inactive)
+static int InputTextLineIndexBuild(ImGuiInputTextFlags flags, ImGuiTextIndex* line_index, const char* buf, const char* buf_end, float wrap_width, int max_output_buffer_size, const char** out_buf_end)
+{
+    ImGuiContext& g = *GImGui;
+    int size = 0;
+    const char* s;
+    bool trailing_line_already_counted = false;
+    if (flags & ImGuiInputTextFlags_WordWrap)
+    {
+        for (s = buf; s < buf_end; s = (*s == '\n') ? s + 1 : s)
+        {
+            if (size++ <= max_output_buffer_size)
+                line_index->Offsets.push_back((int)(s - buf));
+            s = ImFontCalcWordWrapPositionEx(g.Font, g.FontSize, s, buf_end, wrap_width, ImDrawTextFlags_WrapKeepBlanks);
+        }
+    }
+    else if (buf_end != NULL)
+    {
+        for (s = buf; s < buf_end; s = s ? s + 1 : buf_end)
+        {
+            if (size++ <= max_output_buffer_size)
+                line_index->Offsets.push_back((int)(s - buf));
+            s = (const char*)ImMemchr(s, '\n', buf_end - s);
+        }
+    }
+    else
+    {
+        // Inactive path: we don't know buf_end ahead of time.
+        const char* s_eol;
+        for (s = buf; ; s = s_eol + 1)
+        {
+            if (size++ <= max_output_buffer_size)
+                line_index->Offsets.push_back((int)(s - buf));
+            if ((s_eol = strchr(s, '\n')) != NULL)
+                continue;
+            s += strlen(s);
+            trailing_line_already_counted = true;
+            break;
+        }
+    }
+    if (out_buf_end != NULL)
+        *out_buf_end = buf_end = s;
+    if (size == 0)
+    {
+        line_index->Offsets.push_back(0);
+        size++;
+    }
+    if (buf_end > buf && buf_end[-1] == '\n' && !trailing_line_already_counted && size++ <= max_output_buffer_size)
+        line_index->Offsets.push_back((int)(buf_end - buf));
+    return size;
+}
+
+static ImVec2 InputTextLineIndexGetPosOffset(ImGuiContext& g, ImGuiInputTextState* state, ImGuiTextIndex* line_index, const char* buf, const char* buf_end, int cursor_n)
+{
+    const char* cursor_ptr = buf + cursor_n;
+    int* it_begin = line_index->Offsets.begin();
+    int* it_end = line_index->Offsets.end();
+    const int* it = ImLowerBound(it_begin, it_end, cursor_n);
+    if (it > it_begin)
+        if (it == it_end || *it != cursor_n || (state != NULL && state->WrapWidth > 0.0f && state->LastMoveDirectionLR == ImGuiDir_Right && cursor_ptr[-1] != '\n' && cursor_ptr[-1] != 0))
+            it--;
+
+    const int line_no = (it == it_begin) ? 0 : line_index->Offsets.index_from_ptr(it);
+    const char* line_start = line_index->get_line_begin(buf, line_no);
+    ImVec2 offset;
+    offset.x = InputTextCalcTextSize(&g, line_start, cursor_ptr, buf_end, NULL, NULL, ImDrawTextFlags_WrapKeepBlanks).x;
+    offset.y = (line_no + 1) * g.FontSize;
+    return offset;
+}
+
+// Persistent line index for an active multi-line InputText() (state->LineIndex)
+// - Built once by InputTextLineIndexBuild(), then updated by STB_TEXTEDIT_INSERTCHARS()/STB_TEXTEDIT_DELETECHARS() so frame cost doesn't depend on text size.
+// - Layout of a hard line ("paragraph") doesn't depend on other lines, so an edit only requires re-indexing the paragraph(s) it touches and shifting offsets after them.
+// - Word-wrapped index depends on wrap width and font: it is rebuilt when they change.
+static bool InputTextLineIndexIsValid(ImGuiInputTextState* state, float wrap_width)
+{
+    ImGuiContext& g = *state->Ctx;
+    if (!state->LineIndexValid || state->LineIndexWrapWidth != wrap_width)
+        return false;
+    if (wrap_width > 0.0f && (state->LineIndexFont != g.Font || state->LineIndexFontSize != g.FontSize))
+        return false;
+    return true;
+}
+
+// Find paragraph containing [pos_begin, pos_end]. Output end is the start of following paragraph, or INT_MAX if it extends to end of text.
+static void InputTextLineIndexFindParagraph(ImGuiInputTextState* state, int pos_begin, int pos_end, int* out_paragraph_start, int* out_paragraph_end)
+{
+    const char* text = state->TextA.Data;
+    const char* p_eol = (const char*)ImMemchr(text + pos_end, '\n', (size_t)(state->TextLen - pos_end));
+    *out_paragraph_start = (int)(ImStrbol(text + pos_begin, text) - text);
+    *out_paragraph_end = p_eol ? (int)(p_eol - text) + 1 : INT_MAX;
+}
+
+// Output offsets of lines starting within paragraph (excluding paragraph start itself), return count. Pass out_offsets == NULL to only count.
+static int InputTextLineIndexScanParagraph(ImGuiInputTextState* state, int paragraph_start, int paragraph_end, int* out_offsets)
+{
+    ImGuiContext& g = *state->Ctx;
+    const char* text = state->TextA.Data;
+    const char* text_end = text + state->TextLen;
+    const char* end = (paragraph_end == INT_MAX) ? text_end : text + paragraph_end;
+    int count = 0;
+    if (state->LineIndexWrapWidth > 0.0f)
+    {
+        // Same as InputTextLineIndexBuild()
+        for (const char* s = text + paragraph_start; s < end; )
+        {
+            s = ImFontCalcWordWrapPositionEx(g.Font, g.FontSize, s, text_end, state->LineIndexWrapWidth, ImDrawTextFlags_WrapKeepBlanks);
+            if (s < text_end && *s == '\n')
+                s++;
+            if (s >= end)
+                break;
+            if (out_offsets)
+                out_offsets[count] = (int)(s - text);
+            count++;
+        }
+        if (paragraph_end == INT_MAX && text_end > text + paragraph_start && text_end[-1] == '\n')
+        {
+            if (out_offsets)
+                out_offsets[count] = state->TextLen;
+            count++;
+        }
+    }
+    else
+    {
+        for (const char* s = text + paragraph_start; (s = (const char*)ImMemchr(s, '\n', (size_t)(end - s))) != NULL; )
+        {
+            s++;
+            if (s >= end && paragraph_end != INT_MAX)
+                break;
+            if (out_offsets)
+                out_offsets[count] = (int)(s - text);
+            count++;
+        }
+    }
+    return count;
+}
+
+// Replace offsets within (paragraph_start, paragraph_end_old) by offsets within re-indexed (paragraph_start, paragraph_end_new), shift following offsets by 'delta'.
+static void InputTextLineIndexUpdate(ImGuiInputTextState* state, int paragraph_start, int paragraph_end_old, int paragraph_end_new, int delta)
+{
+    ImVector<int>& offsets = state->LineIndex.Offsets;
+    const int lo = (int)(ImLowerBound(offsets.begin(), offsets.end(), paragraph_start + 1) - offsets.begin());
+    const int hi = (paragraph_end_old == INT_MAX) ? offsets.Size : (int)(ImLowerBound(offsets.begin() + lo, offsets.end(), paragraph_end_old) - offsets.begin());
+    const int new_count = InputTextLineIndexScanParagraph(state, paragraph_start, paragraph_end_new, NULL);
+    const int tail_count = offsets.Size - hi;
+    const int size_delta = new_count - (hi - lo);
+    if (size_delta > 0)
+        offsets.resize(offsets.Size + size_delta);
+    if (size_delta != 0 && tail_count > 0)
+        memmove(offsets.Data + lo + new_count, offsets.Data + hi, (size_t)tail_count * sizeof(int));
+    if (size_delta < 0)
+        offsets.resize(offsets.Size + size_delta);
+    if (delta != 0)
+        for (int n = lo + new_count; n < offsets.Size; n++)
+            offsets.Data[n] += delta;
+    InputTextLineIndexScanParagraph(state, paragraph_start, paragraph_end_new, offsets.Data + lo);
+    state->LineIndex.EndOffset = state->TextLen;
+}
+
+// stb_textedit hooks to skip rows preceding the one we are looking for (all rows are g.FontSize high).
+// We start one row early so stb_textedit_find_charpos() may still apply its special handling of wrapping points.
+static int InputTextLineIndexFindRowFromChar(ImGuiInputTextState* state, int char_idx, int* out_prev_row_start, float* out_row_y)
+{
+    *out_prev_row_start = 0;
+    *out_row_y = 0.0f;
+    if (!InputTextLineIndexIsValid(state, state->WrapWidth))
+        return 0;
+    ImVector<int>& offsets = state->LineIndex.Offsets;
+    const int row = (int)(ImLowerBound(offsets.begin(), offsets.end(), char_idx + 1) - offsets.begin()) - 2;
+    if (row <= 0)
+        return 0;
+    *out_prev_row_start = offsets[row - 1];
+    *out_row_y = row * state->Ctx->FontSize;
+    return offsets[row];
+}
+
+static int InputTextLineIndexFindRowFromY(ImGuiInputTextState* state, float y, float* out_row_y)
+{
+    *out_row_y = 0.0f;
+    if (y <= 0.0f || !InputTextLineIndexIsValid(state, state->WrapWidth))
+        return 0;
+    ImVector<int>& offsets = state->LineIndex.Offsets;
+    const int row = ImMin((int)(y / state->Ctx->FontSize), offsets.Size - 1) - 1;
+    if (row <= 0)
+        return 0;
+    *out_row_y = row * state->Ctx->FontSize;
+    return offsets[row];
+}
+
+// Edit a string of text
+// - buf_size account for the zero-terminator, so a buf_size of 6 can hold "Hello" but not "Hello!".
+//   This is so we can easily call InputText() on static arrays using ARRAYSIZE() and to match
+//   Note that in std::string world, capacity() would omit 1 byte used by the zero-terminator.
+// - When active, hold on a privately held copy of the text (and apply back to 'buf'). So changing 'buf' while the InputText is active has no effect.
+// - If you want to use InputText() with std::string or any custom dynamic string type, use the wrapper in misc/cpp/imgui_stdlib.h/.cpp!
+bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    IM_ASSERT(buf != NULL && buf_size >= 0);
+    IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackHistory) && (flags & ImGuiInputTextFlags_Multiline)));        // Can't use both together (they both use up/down keys)
+    IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackCompletion) && (flags & ImGuiInputTextFlags_AllowTabInput))); // Can't use both together (they both use tab key)
+    IM_ASSERT(!((flags & ImGuiInputTextFlags_ElideLeft) && (flags & ImGuiInputTextFlags_Multiline)));              // Multiline does not not work with left-trimming
+    IM_ASSERT((flags & ImGuiInputTextFlags_WordWrap) == 0 || (flags & ImGuiInputTextFlags_Password) == 0);         // WordWrap does not work with Password mode.
+    IM_ASSERT((flags & ImGuiInputTextFlags_WordWrap) == 0 || (flags & ImGuiInputTextFlags_Multiline) != 0);        // WordWrap does not work in single-line mode.
+
+    ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
     const ImGuiStyle& style = g.Style;
 
@@ -4799,6 +6157,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     const bool is_password = (flags & ImGuiInputTextFlags_Password) != 0;
     const bool is_undoable = (flags & ImGuiInputTextFlags_NoUndoRedo) == 0;
     const bool is_resizable = (flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    const bool is_live_edit = (flags & ImGuiInputTextFlags_NoLiveEdit) == 0;
     if (is_resizable)
         IM_ASSERT(callback != NULL); // Must provide a callback if you set the ImGuiInputTextFlags_CallbackResize flag!
 
@@ -4830,12 +6189,17 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         int new_len = (int)ImStrlen(buf);
         IM_ASSERT(new_len + 1 <= buf_size && "Is your input buffer properly zero-terminated?");
         state->WantReloadUserBuf = false;
-        InputTextReconcileUndoState(state, state->TextA.Data, state->TextLen, buf, new_len);
+        state->LineIndexValid = false;
+        InputTextCaptureRevertValue(state, NULL);
+        InputTextReconcileUndoState(state, state->TextA.Data, state->TextLen, buf, new_len, 0, 0);
         state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
         state->TextLen = new_len;
         memcpy(state->TextA.Data, buf, state->TextLen + 1);
+        state->UserBufDirty.Reset(state->TextLen);
+        state->CallbackTextBackupDirty.Invalidate();
         state->Stb->select_start = state->ReloadSelectionStart;
         state->Stb->cursor = state->Stb->select_end = state->ReloadSelectionEnd; // will be clamped to bounds below
+        state->ClearExtraCarets();
     }
     else if ((init_make_active && g.ActiveId != id) || init_changed_specs_multiline || init_changed_specs_readonly)
     {
@@ -4850,11 +6214,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // From the moment we focused we are normally ignoring the content of 'buf' (unless we are in read-only mode)
         const int buf_len = (int)ImStrlen(buf);
         IM_ASSERT(((buf_len + 1 <= buf_size) || (buf_len == 0 && buf_size == 0)) && "Is your input buffer properly zero-terminated?");
+        // (value to revert to is captured lazily on first edit, see InputTextCaptureRevertValue())
         if (!user_scroll_finish)
-        {
-            state->TextToRevertTo.resize(buf_len + 1);    // UTF-8. we use +1 to make sure that .Data is always pointing to at least an empty string.
-            memcpy(state->TextToRevertTo.Data, buf, buf_len + 1);
-        }
+            state->TextToRevertToPending = true;
 
         // Preserve cursor position and undo/redo stack if we come back to same widget
         // FIXME: Since we reworked this on 2022/06, may want to differentiate recycle_cursor vs recycle_undostate?
@@ -4866,6 +6228,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->ID = id;
         state->TextLen = buf_len;
         state->EditedBefore = false;
+        state->LineIndexValid = false;
+        state->ClearExtraCarets();
+        state->UserBufDirty.Reset(state->TextLen);
+        state->CallbackTextBackupDirty.Invalidate();
         if (!is_readonly)
         {
             state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
@@ -4881,6 +6247,19 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // Note a single mouse click will override the cursor/position immediately by calling stb_textedit_click handler.
         if (!recycle_state)
             stb_textedit_initialize_state(state->Stb, !is_multiline);
+        const bool undo_history_was_used = (state->UndoHistory.MemoryBudget > 0);
+        if (!recycle_state || !state->UndoHistory.EnabledByMultiCaret || io.ConfigInputTextUndoMemoryBudget > 0)
+        {
+            state->UndoHistory.MemoryBudget = io.ConfigInputTextUndoMemoryBudget;
+            state->UndoHistory.EnabledByMultiCaret = false;
+        }
+        if (recycle_state && (undo_history_was_used || state->UndoHistory.MemoryBudget > 0))
+            InputTextStbUndoClear(state->Stb); // stb_textedit undo state is not kept in sync while UndoHistory is used: discard it
+        state->UndoHistory.Compress = io.ConfigInputTextUndoCompress;
+        if (!recycle_state || state->UndoHistory.MemoryBudget <= 0)
+            state->UndoHistory.Clear();
+        else if (ImGuiInputTextUndoRecord* rec = state->UndoHistory.UndoStack.back())
+            rec->Sealed = true;
 
         if (!is_multiline)
         {
@@ -4997,12 +6376,17 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const float mouse_x = (io.MousePos.x - frame_bb.Min.x - style.FramePadding.x) + state->Scroll.x;
         const float mouse_y = (is_multiline ? (io.MousePos.y - draw_window->DC.CursorPos.y) : (g.FontSize * 0.5f));
 
+        // Multiple carets: Alt+Click adds a caret, Alt+Shift+Drag selects a block, other clicks remove extra carets.
+        const bool is_multicaret_click = is_multiline && io.KeyAlt && !g.ActiveIdIsJustActivated;
+        if (hovered && io.MouseClicked[0] && !is_multicaret_click)
+            state->ClearExtraCarets();
+
         if (select_all)
         {
             state->SelectAll();
             state->SelectedAllMouseLock = true;
         }
-        else if (hovered && io.MouseClickedCount[0] >= 2 && !io.KeyShift)
+        else if (hovered && io.MouseClickedCount[0] >= 2 && !io.KeyShift && !is_multicaret_click)
         {
             stb_textedit_click(state, state->Stb, mouse_x, mouse_y);
             const int multiclick_count = (io.MouseClickedCount[0] - 2);
@@ -5043,7 +6427,19 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             if (hovered)
             {
-                if (io.KeyShift)
+                if (is_multicaret_click && io.KeyShift)
+                {
+                    state->BlockSelectActive = true;
+                    state->BlockSelectAnchor = ImVec2(mouse_x, mouse_y);
+                    InputTextMultiCaretBlockSelect(state, state->BlockSelectAnchor, state->BlockSelectAnchor);
+                }
+                else if (is_multicaret_click)
+                {
+                    int side_on_line;
+                    const int pos = ImStb::stb_text_locate_coord(state, mouse_x, mouse_y, &side_on_line);
+                    state->AddCaret(pos, pos);
+                }
+                else if (io.KeyShift)
                     stb_textedit_drag(state, state->Stb, mouse_x, mouse_y);
                 else
                     stb_textedit_click(state, state->Stb, mouse_x, mouse_y);
@@ -5052,12 +6448,17 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
         else if (io.MouseDown[0] && !state->SelectedAllMouseLock && (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f))
         {
-            stb_textedit_drag(state, state->Stb, mouse_x, mouse_y);
+            if (state->BlockSelectActive)
+                InputTextMultiCaretBlockSelect(state, state->BlockSelectAnchor, ImVec2(mouse_x, mouse_y));
+            else
+                stb_textedit_drag(state, state->Stb, mouse_x, mouse_y);
             state->CursorAnimReset();
             state->CursorFollow = true;
         }
         if (state->SelectedAllMouseLock && !io.MouseDown[0])
             state->SelectedAllMouseLock = false;
+        if (state->BlockSelectActive && !io.MouseDown[0])
+            state->BlockSelectActive = false;
 
         // We expect backends to emit a Tab key but some also emit a Tab character which we ignore (#2467, #1336)
         // (For Tab and Enter: Win32/SFML/Allegro are sending both keys and chars, GLFW and SDL are only sending keys. For Space they all send all threes)
@@ -5133,31 +6534,33 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // FIXME-OSX: Missing support for Alt(option)+Right/Left = go to end of line, or next line if already in end of line.
         if (IsKeyPressed(ImGuiKey_LeftArrow))                        { state->OnKeyPressed((is_startend_key_down ? STB_TEXTEDIT_K_LINESTART : is_wordmove_key_down ? STB_TEXTEDIT_K_WORDLEFT : STB_TEXTEDIT_K_LEFT) | k_mask); }
         else if (IsKeyPressed(ImGuiKey_RightArrow))                  { state->OnKeyPressed((is_startend_key_down ? STB_TEXTEDIT_K_LINEEND : is_wordmove_key_down ? STB_TEXTEDIT_K_WORDRIGHT : STB_TEXTEDIT_K_RIGHT) | k_mask); }
-        else if (IsKeyPressed(ImGuiKey_UpArrow) && is_multiline)     { if (io.KeyCtrl) SetScrollY(draw_window, ImMax(draw_window->Scroll.y - g.FontSize, 0.0f)); else state->OnKeyPressed((is_startend_key_down ? STB_TEXTEDIT_K_TEXTSTART : STB_TEXTEDIT_K_UP) | k_mask); }
-        else if (IsKeyPressed(ImGuiKey_DownArrow) && is_multiline)   { if (io.KeyCtrl) SetScrollY(draw_window, ImMin(draw_window->Scroll.y + g.FontSize, GetScrollMaxY())); else state->OnKeyPressed((is_startend_key_down ? STB_TEXTEDIT_K_TEXTEND : STB_TEXTEDIT_K_DOWN) | k_mask); }
+        else if (IsKeyPressed(ImGuiKey_UpArrow) && is_multiline)     { if (io.KeyCtrl && io.KeyAlt) InputTextMultiCaretAddVertical(state, STB_TEXTEDIT_K_UP); else if (io.KeyCtrl) SetScrollY(draw_window, ImMax(draw_window->Scroll.y - g.FontSize, 0.0f)); else state->OnKeyPressed((is_startend_key_down ? STB_TEXTEDIT_K_TEXTSTART : STB_TEXTEDIT_K_UP) | k_mask); }
+        else if (IsKeyPressed(ImGuiKey_DownArrow) && is_multiline)   { if (io.KeyCtrl && io.KeyAlt) InputTextMultiCaretAddVertical(state, STB_TEXTEDIT_K_DOWN); else if (io.KeyCtrl) SetScrollY(draw_window, ImMin(draw_window->Scroll.y + g.FontSize, GetScrollMaxY())); else state->OnKeyPressed((is_startend_key_down ? STB_TEXTEDIT_K_TEXTEND : STB_TEXTEDIT_K_DOWN) | k_mask); }
         else if (IsKeyPressed(ImGuiKey_PageUp) && is_multiline)      { state->OnKeyPressed(STB_TEXTEDIT_K_PGUP | k_mask); scroll_y -= row_count_per_page * g.FontSize; }
         else if (IsKeyPressed(ImGuiKey_PageDown) && is_multiline)    { state->OnKeyPressed(STB_TEXTEDIT_K_PGDOWN | k_mask); scroll_y += row_count_per_page * g.FontSize; }
         else if (IsKeyPressed(ImGuiKey_Home))                        { state->OnKeyPressed(io.KeyCtrl ? STB_TEXTEDIT_K_TEXTSTART | k_mask : STB_TEXTEDIT_K_LINESTART | k_mask); }
         else if (IsKeyPressed(ImGuiKey_End))                         { state->OnKeyPressed(io.KeyCtrl ? STB_TEXTEDIT_K_TEXTEND | k_mask : STB_TEXTEDIT_K_LINEEND | k_mask); }
         else if (IsKeyPressed(ImGuiKey_Delete) && !is_readonly && !is_cut)
         {
-            if (!state->HasSelection())
-            {
-                // OSX doesn't seem to have Super+Delete to delete until end-of-line, so we don't emulate that (as opposed to Super+Backspace)
-                if (is_wordmove_key_down)
-                    state->OnKeyPressed(STB_TEXTEDIT_K_WORDRIGHT | STB_TEXTEDIT_K_SHIFT);
-            }
+            // OSX doesn't seem to have Super+Delete to delete until end-of-line, so we don't emulate that (as opposed to Super+Backspace)
+            const int extend_key = is_wordmove_key_down ? (STB_TEXTEDIT_K_WORDRIGHT | STB_TEXTEDIT_K_SHIFT) : 0;
+            if (extend_key != 0 && state->HasExtraCarets())
+                InputTextMultiCaretExtendEmptySelections(state, extend_key);
+            else if (extend_key != 0 && !state->HasSelection())
+                state->OnKeyPressed(extend_key);
             state->OnKeyPressed(STB_TEXTEDIT_K_DELETE | k_mask);
         }
         else if (IsKeyPressed(ImGuiKey_Backspace) && !is_readonly)
         {
-            if (!state->HasSelection())
-            {
-                if (is_wordmove_key_down)
-                    state->OnKeyPressed(STB_TEXTEDIT_K_WORDLEFT | STB_TEXTEDIT_K_SHIFT);
-                else if (is_osx && io.KeyCtrl && !io.KeyAlt && !io.KeySuper)
-                    state->OnKeyPressed(STB_TEXTEDIT_K_LINESTART | STB_TEXTEDIT_K_SHIFT);
-            }
+            int extend_key = 0;
+            if (is_wordmove_key_down)
+                extend_key = STB_TEXTEDIT_K_WORDLEFT | STB_TEXTEDIT_K_SHIFT;
+            else if (is_osx && io.KeyCtrl && !io.KeyAlt && !io.KeySuper)
+                extend_key = STB_TEXTEDIT_K_LINESTART | STB_TEXTEDIT_K_SHIFT;
+            if (extend_key != 0 && state->HasExtraCarets())
+                InputTextMultiCaretExtendEmptySelections(state, extend_key);
+            else if (extend_key != 0 && !state->HasSelection())
+                state->OnKeyPressed(extend_key);
             state->OnKeyPressed(STB_TEXTEDIT_K_BACKSPACE | k_mask);
         }
         else if (is_enter || is_ctrl_enter || is_shift_enter || is_gamepad_validate)
@@ -5183,6 +6586,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     state->OnCharPressed(c);
             }
         }
+        else if (is_cancel && state->HasExtraCarets())
+        {
+            state->ClearExtraCarets();
+        }
         else if (is_cancel)
         {
             if (flags & ImGuiInputTextFlags_EscapeClearsAll)
@@ -5216,7 +6623,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         else if (is_cut || is_copy)
         {
             // Cut, Copy
-            if (g.PlatformIO.Platform_SetClipboardTextFn != NULL)
+            if (g.PlatformIO.Platform_SetClipboardTextFn != NULL && state->HasExtraCarets())
+            {
+                InputTextMultiCaretGetSelectedText(state, &state->MultiCaretBuffer);
+                SetClipboardText(state->MultiCaretBuffer.Data);
+            }
+            else if (g.PlatformIO.Platform_SetClipboardTextFn != NULL)
             {
                 // SetClipboardText() only takes null terminated strings + state->TextSrc may point to read-only user buffer, so we need to make a copy.
                 const int ib = state->HasSelection() ? ImMin(state->Stb->select_start, state->Stb->select_end) : 0;
@@ -5226,7 +6638,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 g.TempBuffer.Data[ie - ib] = 0;
                 SetClipboardText(g.TempBuffer.Data);
             }
-            if (is_cut)
+            if (is_cut && state->HasExtraCarets())
+            {
+                InputTextMultiCaretEdit(state, 0, NULL, 0, false);
+                state->CursorFollow = true;
+            }
+            else if (is_cut)
             {
                 if (!state->HasSelection())
                     state->SelectAll();
@@ -5259,19 +6676,23 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 if (clipboard_filtered.Size > 0) // If everything was filtered, ignore the pasting operation
                 {
                     clipboard_filtered.push_back(0);
-                    stb_textedit_paste(state, state->Stb, clipboard_filtered.Data, clipboard_filtered.Size - 1);
+                    if (state->HasExtraCarets())
+                        InputTextMultiCaretEdit(state, 0, clipboard_filtered.Data, clipboard_filtered.Size - 1, true); // Distribute lines over carets if counts match
+                    else
+                        stb_textedit_paste(state, state->Stb, clipboard_filtered.Data, clipboard_filtered.Size - 1);
                     state->CursorFollow = true;
                 }
             }
         }
 
         // Update render selection flag after events have been handled, so selection highlight can be displayed during the same frame.
-        render_selection |= state->HasSelection() && (RENDER_SELECTION_WHEN_INACTIVE || render_cursor);
+        render_selection |= (state->HasSelection() || state->HasExtraCarets()) && (RENDER_SELECTION_WHEN_INACTIVE || render_cursor);
     }
 
     // Process revert and user callbacks
     const char* apply_new_text = NULL;
     int apply_new_text_length = 0;
+    bool apply_new_text_from_state = false;
     if (g.ActiveId == id)
     {
         IM_ASSERT(state != NULL);
@@ -5281,21 +6702,32 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Clear input
                 IM_ASSERT(state->TextA.Data[0] != 0);
-                apply_new_text = "";
-                apply_new_text_length = 0;
-                value_changed = true;
+                if (is_live_edit)
+                {
+                    apply_new_text = "";
+                    apply_new_text_length = 0;
+                    value_changed = true;
+                }
                 char empty_string = 0;
                 stb_textedit_replace(state, state->Stb, &empty_string, 0);
             }
-            else if (strcmp(state->TextA.Data, state->TextToRevertTo.Data) != 0)
+            else if (!state->TextToRevertToPending) // Otherwise text wasn't modified since activation
             {
-                apply_new_text = state->TextToRevertTo.Data;
-                apply_new_text_length = state->TextToRevertTo.Size - 1;
-
-                // Restore initial value. Only return true if restoring to the initial value changes the current buffer contents.
-                // Push records into the undo stack so we can Ctrl+Z the revert operation itself
-                value_changed = true;
-                stb_textedit_replace(state, state->Stb, state->TextToRevertTo.Data, state->TextToRevertTo.Size - 1);
+                // With ImGuiInputTextFlags_NoLiveEdit the user buffer still holds the initial value.
+                const char* revert_text = is_live_edit ? state->TextToRevertTo.Data : buf;
+                const int revert_text_len = is_live_edit ? state->TextToRevertTo.Size - 1 : (int)ImStrlen(buf);
+                if (strcmp(state->TextA.Data, revert_text) != 0)
+                {
+                    // Restore initial value. Only return true if restoring to the initial value changes the current buffer contents.
+                    // Push records into the undo stack so we can Ctrl+Z the revert operation itself
+                    if (is_live_edit)
+                    {
+                        apply_new_text = revert_text;
+                        apply_new_text_length = revert_text_len;
+                        value_changed = true;
+                    }
+                    stb_textedit_replace(state, state->Stb, revert_text, revert_text_len);
+                }
             }
         }
 
@@ -5341,11 +6773,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 callback_data.EventActivated = (g.ActiveId == state->ID && g.ActiveIdIsJustActivated);
                 callback_data.UserData = callback_user_data;
 
-                // FIXME-OPT: Undo stack reconcile needs a backup of the data until we rework API, see #7925
+                // Undo stack reconcile needs a backup of the data until we rework API, see #7925
+                // The backup is kept between calls and we only copy the part of text modified since previous call.
                 char* callback_buf = is_readonly ? buf : state->TextA.Data;
                 IM_ASSERT(callback_buf == state->TextSrc);
-                state->CallbackTextBackup.resize(state->TextLen + 1);
-                memcpy(state->CallbackTextBackup.Data, callback_buf, state->TextLen + 1);
+                if (is_readonly)
+                    state->CallbackTextBackupDirty.Invalidate();
+                if (state->CallbackTextBackupDirty.IsDirty() || !state->CallbackTextBackupDirty.IsValid())
+                {
+                    state->CallbackTextBackup.resize(state->TextLen + 1);
+                    InputTextCopyDirtyRange(state->CallbackTextBackup.Data, callback_buf, state->TextLen, state->CallbackTextBackupDirty);
+                }
+                state->CallbackTextBackupDirty.Reset(state->TextLen);
 
                 callback_data.EventKey = event_key;
                 callback_data.Buf = callback_buf;
@@ -5372,21 +6811,68 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 if (callback_data.BufDirty)
                 {
                     // Callback may update buffer and thus set buf_dirty even in read-only mode.
+                    state->ClearExtraCarets();
+                    // When modified with DeleteChars()/InsertChars() we know which part changed, otherwise compare everything.
                     IM_ASSERT(callback_data.BufTextLen == (int)ImStrlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
-                    InputTextReconcileUndoState(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.Buf, callback_data.BufTextLen);
+                    ImGuiTextDirtyRange& backup_dirty = state->CallbackTextBackupDirty;
+                    if (backup_dirty.IsDirty())
+                    {
+                        InputTextReconcileUndoState(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.Buf, callback_data.BufTextLen, backup_dirty.Begin, backup_dirty.TailLen);
+                    }
+                    else
+                    {
+                        InputTextReconcileUndoState(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.Buf, callback_data.BufTextLen, 0, 0);
+                        backup_dirty.Invalidate();
+                        state->UserBufDirty.Invalidate();
+                    }
+                    if (!is_readonly && state->TextToRevertToPending)
+                    {
+                        InputTextCaptureRevertValue(state, &state->CallbackTextBackup);
+                        backup_dirty.Invalidate(); // Backup may have been moved to TextToRevertTo
+                    }
                     state->TextLen = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                    state->EditedBefore = true;
+                    state->LineIndexValid = false;
                     state->CursorAnimReset();
                 }
             }
         }
 
         // Will copy result string if modified.
-        // FIXME-OPT: Could mark dirty state from the stb_textedit callbacks
-        if (!is_readonly && strcmp(state->TextSrc, buf) != 0)
+        // - While active, we only compare the part of text modified since the last copy to user buffer (see UserBufDirty), and copy everything if it changed.
+        // - When deactivating, we compare everything, so that we always reapply our value even if user buffer isn't retained (see comments below).
+        // - With ImGuiInputTextFlags_NoLiveEdit, only when deactivating here and if text was edited. Edits are still recorded so IsItemDeactivatedAfterEdit() works
+        //   when deactivated by another item, in which case text is applied on next frame by the InputTextDeactivatedState path below.
+        if (!is_live_edit && state->EditedBefore)
+            g.ActiveIdHasBeenEditedBefore = true;
+        // - Checking user buffer length hasn't changed is a cheap way to detect most modifications done to it behind our back, in which case we compare everything.
+        ImGuiTextDirtyRange& dirty = state->UserBufDirty;
+        const bool user_buf_unchanged = dirty.IsValid() && dirty.RefLen < buf_size && state->TextLen < buf_size && buf[dirty.RefLen] == 0;
+        if (!is_readonly && is_live_edit && !clear_active_id && user_buf_unchanged)
+        {
+            if (dirty.IsDirty() && dirty.RefLen == state->TextLen && memcmp(buf + dirty.Begin, state->TextSrc + dirty.Begin, (size_t)(state->TextLen - dirty.TailLen - dirty.Begin)) == 0)
+                dirty.Reset(state->TextLen); // Modified and restored: no change
+            if (dirty.IsDirty())
+            {
+                apply_new_text = state->TextSrc;
+                apply_new_text_length = state->TextLen;
+                apply_new_text_from_state = true;
+                value_changed = true;
+            }
+        }
+        else if (!is_readonly && (is_live_edit || (clear_active_id && state->EditedBefore)))
         {
-            apply_new_text = state->TextSrc;
-            apply_new_text_length = state->TextLen;
-            value_changed = true;
+            if (strcmp(state->TextSrc, buf) != 0)
+            {
+                apply_new_text = state->TextSrc;
+                apply_new_text_length = state->TextLen;
+                apply_new_text_from_state = true;
+                value_changed = true;
+            }
+            else
+            {
+                dirty.Reset(state->TextLen);
+            }
         }
     }
 
@@ -5434,7 +6920,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         //IMGUI_DEBUG_PRINT("InputText(\"%s\"): apply_new_text length %d\n", label, apply_new_text_length);
 
         // If the underlying buffer resize was denied or not carried to the next frame, apply_new_text_length+1 may be >= buf_size.
+        // We always copy the whole text: the user buffer may have been modified outside of the dirty range (which is only used to detect changes).
         ImStrncpy(buf, apply_new_text, ImMin(apply_new_text_length + 1, buf_size));
+        if (apply_new_text_from_state && apply_new_text_length == state->TextLen && apply_new_text_length + 1 <= buf_size)
+            state->UserBufDirty.Reset(state->TextLen);
+        else if (state != NULL && state->ID == id)
+            state->UserBufDirty.Invalidate();
     }
 
     // Release active ID at the end of the function (so e.g. pressing Return still does a final application of the value)
@@ -5493,10 +6984,26 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         CalcClipRectVisibleItemsY(clip_rect, draw_pos, g.FontSize, &line_visible_n0, &line_visible_n1);
 
     // Build line index for easy data access (makes code below simpler and faster)
+    // When displaying from our state, use persistent line index which is updated on edits, otherwise rebuild one every frame.
     ImGuiTextIndex* line_index = &g.InputTextLineIndex;
     line_index->Offsets.resize(0);
     int line_count = 1;
-    if (is_multiline)
+    if (is_multiline && buf_display_from_state && !is_displaying_hint)
+    {
+        line_index = &state->LineIndex;
+        buf_display_end = buf_display + state->TextLen; // May have been left to NULL if we deactivated during this frame.
+        if (!InputTextLineIndexIsValid(state, wrap_width))
+        {
+            line_index->Offsets.resize(0);
+            InputTextLineIndexBuild(flags, line_index, buf_display, buf_display_end, wrap_width, INT_MAX, NULL);
+            state->LineIndexWrapWidth = wrap_width;
+            state->LineIndexFont = g.Font;
+            state->LineIndexFontSize = g.FontSize;
+            state->LineIndexValid = true;
+        }
+        line_count = line_index->Offsets.Size;
+    }
+    else if (is_multiline)
     {
         // If scrolling is expected to change build full index.
         // FIXME-OPT: Could append to index when new value of line_visible_n1 becomes bigger, see second call to CalcClipRectVisibleItemsY() below.
@@ -5584,34 +7091,50 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             const float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             const float bg_eol_width = IM_TRUNC(g.FontBaked->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
 
-            const char* text_selected_begin = buf_display + ImMin(state->Stb->select_start, state->Stb->select_end);
-            const char* text_selected_end = buf_display + ImMax(state->Stb->select_start, state->Stb->select_end);
-            for (int line_n = line_visible_n0; line_n < line_visible_n1; line_n++)
+            // Main selection, then selections of extra carets (only iterating visible lines each selection spans)
+            for (int caret_n = -1; caret_n < state->ExtraCarets.Size; caret_n++)
             {
-                const char* p = line_index->get_line_begin(buf_display, line_n);
-                const char* p_eol = line_index->get_line_end(buf_display, line_n);
-                const bool p_eol_is_wrap = (p_eol < buf_display_end && *p_eol != '\n');
-                if (p_eol_is_wrap)
-                    p_eol++;
-                const char* line_selected_begin = (text_selected_begin > p) ? text_selected_begin : p;
-                const char* line_selected_end = (text_selected_end < p_eol) ? text_selected_end : p_eol;
-
-                float rect_width = 0.0f;
-                if (line_selected_begin < line_selected_end)
-                    rect_width += CalcTextSize(line_selected_begin, line_selected_end).x;
-                if (text_selected_begin <= p_eol && text_selected_end > p_eol && !p_eol_is_wrap)
-                    rect_width += bg_eol_width; // So we can see selected empty lines
-                if (rect_width == 0.0f)
+                const int sel_min = (caret_n < 0) ? ImMin(state->Stb->select_start, state->Stb->select_end) : state->ExtraCarets[caret_n].GetMin();
+                const int sel_max = (caret_n < 0) ? ImMax(state->Stb->select_start, state->Stb->select_end) : state->ExtraCarets[caret_n].GetMax();
+                if (sel_min == sel_max)
                     continue;
+                int sel_line_n0 = line_visible_n0, sel_line_n1 = line_visible_n1;
+                if (caret_n >= 0 && line_index->Offsets.Size > 0)
+                {
+                    int* offsets_begin = line_index->Offsets.begin();
+                    int* offsets_end = line_index->Offsets.end();
+                    sel_line_n0 = ImMax(sel_line_n0, (int)(ImLowerBound(offsets_begin, offsets_end, sel_min + 1) - offsets_begin) - 2);
+                    sel_line_n1 = ImMin(sel_line_n1, (int)(ImLowerBound(offsets_begin, offsets_end, sel_max + 1) - offsets_begin) + 1);
+                }
+                const char* text_selected_begin = buf_display + sel_min;
+                const char* text_selected_end = buf_display + sel_max;
+                for (int line_n = sel_line_n0; line_n < sel_line_n1; line_n++)
+                {
+                    const char* p = line_index->get_line_begin(buf_display, line_n);
+                    const char* p_eol = line_index->get_line_end(buf_display, line_n);
+                    const bool p_eol_is_wrap = (p_eol < buf_display_end && *p_eol != '\n');
+                    if (p_eol_is_wrap)
+                        p_eol++;
+                    const char* line_selected_begin = (text_selected_begin > p) ? text_selected_begin : p;
+                    const char* line_selected_end = (text_selected_end < p_eol) ? text_selected_end : p_eol;
+
+                    float rect_width = 0.0f;
+                    if (line_selected_begin < line_selected_end)
+                        rect_width += CalcTextSize(line_selected_begin, line_selected_end).x;
+                    if (text_selected_begin <= p_eol && text_selected_end > p_eol && !p_eol_is_wrap)
+                        rect_width += bg_eol_width; // So we can see selected empty lines
+                    if (rect_width == 0.0f)
+                        continue;
 
-                ImRect rect;
-                rect.Min.x = draw_pos.x - draw_scroll.x + CalcTextSize(p, line_selected_begin).x;
-                rect.Min.y = draw_pos.y - draw_scroll.y + line_n * g.FontSize;
-                rect.Max.x = rect.Min.x + rect_width;
-                rect.Max.y = rect.Min.y + bg_offy_dn + g.FontSize;
-                rect.Min.y += bg_offy_up;
-                rect.ClipWith(clip_rect);
-                draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+                    ImRect rect;
+                    rect.Min.x = draw_pos.x - draw_scroll.x + CalcTextSize(p, line_selected_begin).x;
+                    rect.Min.y = draw_pos.y - draw_scroll.y + line_n * g.FontSize;
+                    rect.Max.x = rect.Min.x + rect_width;
+                    rect.Max.y = rect.Min.y + bg_offy_dn + g.FontSize;
+                    rect.Min.y += bg_offy_up;
+                    rect.ClipWith(clip_rect);
+                    draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+                }
             }
         }
     }
@@ -5640,6 +7163,22 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
             draw_window->DrawList->AddLineV(cursor_screen_rect.Min.x, cursor_screen_rect.Min.y, cursor_screen_rect.Max.y, GetColorU32(ImGuiCol_InputTextCursor), 1.0f * (float)(int)style._MainScale); // FIXME-DPI: Cursor thickness (#7031)
 
+        // Render extra carets (on visible lines only)
+        if (cursor_is_visible && state->HasExtraCarets() && buf_display_from_state && line_visible_n0 < line_visible_n1)
+        {
+            const int visible_begin = (int)(line_index->get_line_begin(buf_display, line_visible_n0) - buf_display);
+            const int visible_end = (int)(line_index->get_line_end(buf_display, line_visible_n1 - 1) - buf_display);
+            for (const ImGuiInputTextCaret& caret : state->ExtraCarets)
+            {
+                if (caret.Cursor < visible_begin || caret.Cursor > visible_end)
+                    continue;
+                ImVec2 caret_screen_pos = ImTrunc(draw_pos + InputTextLineIndexGetPosOffset(g, state, line_index, buf_display, buf_display_end, caret.Cursor) - draw_scroll);
+                ImRect caret_screen_rect(caret_screen_pos.x, caret_screen_pos.y - g.FontSize + 0.5f, caret_screen_pos.x + 1.0f, caret_screen_pos.y - 1.5f);
+                if (caret_screen_rect.Overlaps(clip_rect))
+                    draw_window->DrawList->AddLineV(caret_screen_rect.Min.x, caret_screen_rect.Min.y, caret_screen_rect.Max.y, GetColorU32(ImGuiCol_InputTextCursor), 1.0f * (float)(int)style._MainScale);
+            }
+        }
+
         // Notify OS of text input position for advanced IME (-1 x offset so that Windows IME can cover our cursor. Bit of an extra nicety.)
         // This is required for some backends (SDL3) to start emitting character/text inputs.
         // As per #6341, make sure we don't set that on the deactivating frame.
@@ -5712,6 +7251,48 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
     Text("BufCapacity: %d, LineCount: %d", state->BufCapacity, state->LineCount);
     Text("(Internal Buffer: TextA Size: %d, Capacity: %d)", state->TextA.Size, state->TextA.Capacity);
     Text("has_preferred_x: %d (%.2f)", stb_state->has_preferred_x, stb_state->preferred_x);
+    ImGuiInputTextUndoHistory* history = &state->UndoHistory;
+    if (history->MemoryBudget > 0)
+    {
+        int compressed_count = 0;
+        for (int stack_n = 0; stack_n < 2; stack_n++)
+        {
+            const ImGuiInputTextUndoStack* stack = (stack_n == 0) ? &history->UndoStack : &history->RedoStack;
+            for (int n = stack->RecordsHead; n < stack->Records.Size; n++)
+                compressed_count += stack->Records[n].Compressed ? 1 : 0;
+        }
+        Text("UndoHistory: %d undo, %d redo steps, %d compressed", history->UndoStack.GetCount(), history->RedoStack.GetCount(), compressed_count);
+        Text("UndoHistory: memory %d / %d bytes (storage capacity: %d bytes)", history->GetMemoryUsage(), history->MemoryBudget,
+            history->UndoStack.Data.Capacity + history->RedoStack.Data.Capacity + history->TempBuffer.Capacity + history->TempRanges.Capacity * (int)sizeof(ImGuiInputTextUndoRange) + (history->UndoStack.Records.Capacity + history->RedoStack.Records.Capacity) * (int)sizeof(ImGuiInputTextUndoRecord));
+        if (BeginChild("undohistory", ImVec2(0.0f, GetTextLineHeight() * 10), ImGuiChildFlags_Borders | ImGuiChildFlags_ResizeY)) // Visualize undo history, most recent steps first
+        {
+            PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            const int undo_count = history->UndoStack.GetCount();
+            ImGuiListClipper clipper;
+            clipper.Begin(undo_count + history->RedoStack.GetCount());
+            while (clipper.Step())
+                for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                {
+                    // Display redo steps (farthest first) then undo steps (most recent first)
+                    const int redo_count = history->RedoStack.GetCount();
+                    const bool is_redo = (n < redo_count);
+                    const ImGuiInputTextUndoStack* stack = is_redo ? &history->RedoStack : &history->UndoStack;
+                    const ImGuiInputTextUndoRecord* rec = is_redo ? &stack->Records[stack->RecordsHead + n] : &stack->Records[stack->Records.Size - 1 - (n - redo_count)];
+                    if (rec->RangesCount > 0)
+                    {
+                        Text("%c where %03d, remove %03d, insert %03d, size %03d, %d ranges%s", is_redo ? 'r' : 'u',
+                            rec->Where, rec->RemoveLen, rec->InsertLen, rec->DataSize, rec->RangesCount, rec->Sealed ? "" : " (open)");
+                        continue;
+                    }
+                    const int buf_preview_len = rec->Compressed ? 0 : ImMin(rec->InsertLen, 64);
+                    Text("%c where %03d, remove %03d, insert %03d, size %03d%s%s \"%.*s\"", is_redo ? 'r' : 'u',
+                        rec->Where, rec->RemoveLen, rec->InsertLen, rec->DataSize, rec->Compressed ? " (compressed)" : "", rec->Sealed ? "" : " (open)", buf_preview_len, stack->Data.Data + rec->DataOffset);
+                }
+            PopStyleVar();
+        }
+        EndChild();
+        return;
+    }
     Text("undo_point: %d, redo_point: %d, undo_char_point: %d, redo_char_point: %d", undo_state->undo_point, undo_state->redo_point, undo_state->undo_char_point, undo_state->redo_char_point);
     if (BeginChild("undopoints", ImVec2(0.0f, GetTextLineHeight() * 10), ImGuiChildFlags_Borders | ImGuiChildFlags_ResizeY)) // Visualize undo state
     {
@@ -6686,6 +8267,8 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - GetTreeNodeToLabelSpacing()
 // - SetNextItemOpen()
 // - CollapsingHeader()
+// - ImGuiTreeView
+// - TreeViewNode()
 //-------------------------------------------------------------------------
 
 bool ImGui::TreeNode(const char* str_id, const char* fmt, ...)
@@ -7156,13 +8739,21 @@ void ImGui::TreeNodeDrawLineToChildNode(const ImVec2& target_pos)
         return;
 
     ImGuiTreeNodeStackData* parent_data = &g.TreeNodeStack.Data[g.TreeNodeStack.Size - 1];
-    float x1 = ImTrunc(parent_data->DrawLinesX1);
+    float y2 = TreeNodeDrawLineToChildNodeEx(parent_data->DrawLinesX1, target_pos);
+    parent_data->DrawLinesToNodesY2 = ImMax(parent_data->DrawLinesToNodesY2, y2);
+}
+
+// Draw horizontal line from vertical line at 'x1' to child node. Return Y position the vertical line needs to reach.
+float ImGui::TreeNodeDrawLineToChildNodeEx(float x1, const ImVec2& target_pos)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    x1 = ImTrunc(x1);
     float x2 = ImTrunc(target_pos.x - g.Style.ItemInnerSpacing.x);
     float y = ImTrunc(target_pos.y);
     float rounding = (g.Style.TreeLinesRounding > 0.0f) ? ImMin(x2 - x1, g.Style.TreeLinesRounding) : 0.0f;
-    parent_data->DrawLinesToNodesY2 = ImMax(parent_data->DrawLinesToNodesY2, y - rounding);
     if (x1 >= x2)
-        return;
+        return y - rounding;
     if (rounding > 0.0f)
     {
         x1 += 0.5f + rounding;
@@ -7175,6 +8766,7 @@ void ImGui::TreeNodeDrawLineToChildNode(const ImVec2& target_pos)
     {
         window->DrawList->AddLineH(x1, x2, y, GetColorU32(ImGuiCol_TreeLines), g.Style.TreeLinesSize);
     }
+    return y - rounding;
 }
 
 // Draw vertical line of the hierarchy
@@ -7337,6 +8929,193 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
     return is_open;
 }
 
+// Append visible descendants of 'parent_node' to 'out', in display order.
+// We use an explicit stack as user trees may be very deep.
+static void TreeViewAddVisibleNodes(ImGuiTreeView* tree, int parent_node, int depth, ImU32 lines_mask, ImVector<ImGuiTreeViewNode>* out)
+{
+    struct StackEntry { int Node, ChildN, ChildrenCount, Depth; ImU32 LinesMask; };
+    ImVector<StackEntry> stack;
+    StackEntry root_entry = { parent_node, 0, tree->GetChildrenCountFunc(tree->UserData, parent_node), depth, lines_mask };
+    stack.push_back(root_entry);
+    while (stack.Size > 0)
+    {
+        StackEntry* entry = &stack.back();
+        if (entry->ChildN == entry->ChildrenCount)
+        {
+            stack.pop_back();
+            continue;
+        }
+        const int child_n = entry->ChildN++;
+        const bool has_next_sibling = (child_n + 1 < entry->ChildrenCount);
+        IM_ASSERT(entry->Depth < 0x7FFF);
+
+        ImGuiTreeViewNode node;
+        node.Node = tree->GetChildFunc(tree->UserData, entry->Node, child_n);
+        node.Depth = (ImS16)entry->Depth;
+        node.LinesMask = entry->LinesMask | ((has_next_sibling && entry->Depth >= 1 && entry->Depth <= 32) ? (1u << (entry->Depth - 1)) : 0);
+        node.IsOpen = tree->OpenStorage.GetInt((ImGuiID)node.Node, 0) != 0;
+        out->push_back(node);
+
+        const int children_count = node.IsOpen ? tree->GetChildrenCountFunc(tree->UserData, node.Node) : 0;
+        if (children_count > 0)
+        {
+            StackEntry child_entry = { node.Node, 0, children_count, entry->Depth + 1, node.LinesMask };
+            stack.push_back(child_entry); // May invalidate 'entry'
+        }
+    }
+}
+
+ImGuiTreeView::ImGuiTreeView()
+{
+    UserData = NULL;
+    GetChildrenCountFunc = NULL;
+    GetChildFunc = NULL;
+}
+
+void ImGuiTreeView::Rebuild()
+{
+    IM_ASSERT(GetChildrenCountFunc != NULL && GetChildFunc != NULL);
+    Nodes.resize(0);
+    _Requests.resize(0);
+    TreeViewAddVisibleNodes(this, -1, 0, 0, &Nodes);
+}
+
+void ImGuiTreeView::SetNodeOpen(int node_n, bool open)
+{
+    IM_ASSERT(node_n >= 0 && node_n < Nodes.Size);
+    ImGuiTreeViewNode node = Nodes[node_n];
+    OpenStorage.SetInt((ImGuiID)node.Node, open ? 1 : 0);
+    if (node.IsOpen == open)
+        return;
+    Nodes[node_n].IsOpen = open;
+
+    if (open)
+    {
+        // Insert visible descendants after the node
+        ImVector<ImGuiTreeViewNode> descendants;
+        TreeViewAddVisibleNodes(this, node.Node, node.Depth + 1, node.LinesMask, &descendants);
+        if (descendants.Size == 0)
+            return;
+        const int tail_count = Nodes.Size - (node_n + 1);
+        Nodes.resize(Nodes.Size + descendants.Size);
+        memmove(Nodes.Data + node_n + 1 + descendants.Size, Nodes.Data + node_n + 1, (size_t)tail_count * sizeof(ImGuiTreeViewNode));
+        memcpy(Nodes.Data + node_n + 1, descendants.Data, (size_t)descendants.Size * sizeof(ImGuiTreeViewNode));
+    }
+    else
+    {
+        // Remove visible descendants
+        int end_n = node_n + 1;
+        while (end_n < Nodes.Size && Nodes[end_n].Depth > node.Depth)
+            end_n++;
+        if (end_n > node_n + 1)
+            Nodes.erase(Nodes.Data + node_n + 1, Nodes.Data + end_n);
+    }
+}
+
+// Process from the bottom so requests don't shift indices of each others.
+void ImGuiTreeView::ApplyRequests()
+{
+    if (_Requests.Size == 0)
+        return;
+    ImQsort(_Requests.Data, (size_t)_Requests.Size, sizeof(int), [](const void* lhs, const void* rhs) { return *(const int*)rhs - *(const int*)lhs; });
+    int prev_node_n = -1;
+    for (int node_n : _Requests)
+        if (node_n != prev_node_n && node_n < Nodes.Size)
+        {
+            SetNodeOpen(node_n, IsNodeOpen(Nodes[node_n].Node));
+            prev_node_n = node_n;
+        }
+    _Requests.resize(0);
+}
+
+// Nothing is pushed on the ID or tree stack: we emulate depth with Indent() and draw tree lines for each row from the flattened index,
+// so any clipped range of rows displays correct lines. Opening/closing is stored in tree->OpenStorage and queued for ApplyRequests().
+bool ImGui::TreeViewNode(ImGuiTreeView* tree, int node_n, const char* label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (window->SkipItems)
+        return false;
+    IM_ASSERT(node_n >= 0 && node_n < tree->Nodes.Size);
+    const ImGuiTreeViewNode* node = &tree->Nodes[node_n];
+    const bool is_leaf = tree->GetChildrenCountFunc(tree->UserData, node->Node) == 0;
+    if (is_leaf)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+
+    // Lines are drawn below instead of using the tree node stack
+    if ((flags & ImGuiTreeNodeFlags_DrawLinesMask_) == 0)
+        flags |= g.Style.TreeLinesFlags;
+    const ImGuiTreeNodeFlags lines_flags = flags & (ImGuiTreeNodeFlags_DrawLinesFull | ImGuiTreeNodeFlags_DrawLinesToNodes);
+    flags = (flags & ~ImGuiTreeNodeFlags_DrawLinesMask_) | ImGuiTreeNodeFlags_DrawLinesNone | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+
+    const float indent_w = node->Depth * g.Style.IndentSpacing;
+    if (indent_w > 0.0f)
+        Indent(indent_w);
+    const ImVec2 node_pos = window->DC.CursorPos;
+    if (g.CurrentMultiSelect != NULL && (g.NextItemData.ItemFlags & ImGuiItemFlags_HasSelectionUserData) == 0)
+        SetNextItemSelectionUserData(node_n);
+    SetNextItemStorageID((ImGuiID)node->Node);
+    ImGuiStorage* backup_storage = window->DC.StateStorage;
+    window->DC.StateStorage = &tree->OpenStorage;
+    const bool is_open = TreeNodeBehavior(window->GetID(node->Node), flags, label);
+    window->DC.StateStorage = backup_storage;
+    if (indent_w > 0.0f)
+        Unindent(indent_w);
+
+    if (!is_leaf && is_open != node->IsOpen && !g.LogEnabled)
+    {
+        tree->OpenStorage.SetInt((ImGuiID)node->Node, is_open ? 1 : 0); // Also covers ImGuiTreeNodeFlags_DefaultOpen
+        tree->_Requests.push_back(node_n);
+    }
+
+    // Draw vertical lines of every parent level crossing this row, and horizontal line from parent.
+    // Each row covers from the bottom of previous row to its own bottom, so any range of rows displays correct lines.
+    if (lines_flags != 0 && node->Depth > 0 && g.Style.TreeLinesSize > 0.0f)
+    {
+        const ImRect frame_bb = g.LastItemData.DisplayRect;
+        float row_y1, row_y2;
+        if (ImGuiTable* table = g.CurrentTable)
+        {
+            row_y1 = table->RowPosY1;
+            row_y2 = ImMax(table->RowPosY2, frame_bb.Max.y + table->RowCellPaddingY);
+        }
+        else
+        {
+            row_y1 = node_pos.y - g.Style.ItemSpacing.y;
+            row_y2 = frame_bb.Max.y;
+        }
+        if (row_y2 >= window->ClipRect.Min.y && row_y1 < window->ClipRect.Max.y)
+        {
+            const ImU32 col = GetColorU32(ImGuiCol_TreeLines);
+            const int next_depth = (node_n + 1 < tree->Nodes.Size) ? tree->Nodes[node_n + 1].Depth : 0;
+            const float lines_x0 = node_pos.x - indent_w + g.FontSize * 0.5f + g.Style.FramePadding.x;
+            const float y_mid = frame_bb.Min.y + (frame_bb.Max.y - frame_bb.Min.y) * 0.5f;
+            const float parent_line_y2 = TreeNodeDrawLineToChildNodeEx(lines_x0 + (node->Depth - 1) * g.Style.IndentSpacing, ImVec2(node_pos.x + g.Style.FramePadding.x, y_mid));
+            for (int depth_n = 0; depth_n < node->Depth && depth_n < 32; depth_n++)
+            {
+                // ImGuiTreeNodeFlags_DrawLinesFull: line continues while next row is a descendant of this level.
+                // ImGuiTreeNodeFlags_DrawLinesToNodes: line continues while the node at next level has a next sibling.
+                const bool is_parent_level = (depth_n == node->Depth - 1);
+                const bool line_continues = (lines_flags & ImGuiTreeNodeFlags_DrawLinesFull) ? (next_depth > depth_n) : (node->LinesMask & (1u << depth_n)) != 0;
+                float y2 = row_y2;
+                if (!line_continues)
+                {
+                    if (is_parent_level)
+                        y2 = parent_line_y2;
+                    else if (lines_flags & ImGuiTreeNodeFlags_DrawLinesFull)
+                        y2 = ImTrunc(y_mid);
+                    else
+                        continue;
+                }
+                if (y2 > row_y1)
+                    window->DrawList->AddLineV(ImTrunc(lines_x0 + depth_n * g.Style.IndentSpacing), row_y1, y2, col, g.Style.TreeLinesSize);
+            }
+        }
+    }
+
+    return is_open;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
@@ -8575,6 +10354,7 @@ void ImGui::DebugNodeMultiSelectState(ImGuiMultiSelectState* storage)
 // [SECTION] Widgets: Multi-Select helpers
 //-------------------------------------------------------------------------
 // - ImGuiSelectionBasicStorage
+// - ImGuiSelectionRangeStorage
 // - ImGuiSelectionExternalStorage
 //-------------------------------------------------------------------------
 
@@ -8740,6 +10520,147 @@ void ImGuiSelectionBasicStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
 
 //-------------------------------------------------------------------------
 
+ImGuiSelectionRangeStorage::ImGuiSelectionRangeStorage()
+{
+    Size = 0;
+    _IterRange = 0;
+}
+
+void ImGuiSelectionRangeStorage::Clear()
+{
+    Size = 0;
+    _IterRange = 0;
+    Ranges.resize(0);
+}
+
+void ImGuiSelectionRangeStorage::Swap(ImGuiSelectionRangeStorage& r)
+{
+    ImSwap(Size, r.Size);
+    ImSwap(_IterRange, r._IterRange);
+    Ranges.swap(r.Ranges);
+}
+
+// Return index of first range with Last >= idx (== ranges_count if none)
+static int ImGuiSelectionRangeStorage_LowerBound(const ImGuiSelectionRange* ranges, int ranges_count, int idx)
+{
+    int lo = 0, hi = ranges_count;
+    while (lo < hi)
+    {
+        const int mid = lo + ((hi - lo) >> 1);
+        if (ranges[mid].Last < idx)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+bool ImGuiSelectionRangeStorage::Contains(int idx) const
+{
+    const int range_n = ImGuiSelectionRangeStorage_LowerBound(Ranges.Data, Ranges.Size, idx);
+    return range_n < Ranges.Size && Ranges.Data[range_n].First <= idx;
+}
+
+void ImGuiSelectionRangeStorage::SetItemSelected(int idx, bool selected)
+{
+    SetRangeSelected(idx, idx, selected);
+}
+
+void ImGuiSelectionRangeStorage::SetRangeSelected(int first, int last, bool selected)
+{
+    IM_ASSERT(first >= 0 && first <= last);
+
+    // Find ranges [range_lo, range_hi) overlapping [first, last], including adjacent ranges when selecting (so they get merged)
+    const int margin = selected ? 1 : 0;
+    const int range_lo = ImGuiSelectionRangeStorage_LowerBound(Ranges.Data, Ranges.Size, first - margin);
+    int range_hi = range_lo;
+    while (range_hi < Ranges.Size && Ranges.Data[range_hi].First <= last + margin)
+        range_hi++;
+
+    // Compute replacement ranges: a single merged range when selecting, the surviving left/right parts when unselecting
+    ImGuiSelectionRange new_ranges[2];
+    int new_count = 0;
+    if (selected)
+    {
+        ImGuiSelectionRange r = { first, last };
+        if (range_lo < range_hi)
+        {
+            r.First = ImMin(first, Ranges.Data[range_lo].First);
+            r.Last = ImMax(last, Ranges.Data[range_hi - 1].Last);
+        }
+        new_ranges[new_count++] = r;
+    }
+    else
+    {
+        if (range_lo == range_hi)
+            return;
+        if (Ranges.Data[range_lo].First < first)
+            new_ranges[new_count++] = { Ranges.Data[range_lo].First, first - 1 };
+        if (Ranges.Data[range_hi - 1].Last > last)
+            new_ranges[new_count++] = { last + 1, Ranges.Data[range_hi - 1].Last };
+    }
+    for (int range_n = range_lo; range_n < range_hi; range_n++)
+        Size -= Ranges.Data[range_n].Last - Ranges.Data[range_n].First + 1;
+    for (int range_n = 0; range_n < new_count; range_n++)
+        Size += new_ranges[range_n].Last - new_ranges[range_n].First + 1;
+
+    // Replace Ranges[range_lo..range_hi) with new ranges, shifting the tail once
+    const int delta = new_count - (range_hi - range_lo);
+    const int tail_count = Ranges.Size - range_hi;
+    if (delta > 0)
+        Ranges.resize(Ranges.Size + delta);
+    if (delta != 0 && tail_count > 0)
+        memmove(Ranges.Data + range_hi + delta, Ranges.Data + range_hi, (size_t)tail_count * sizeof(ImGuiSelectionRange));
+    if (delta < 0)
+        Ranges.resize(Ranges.Size + delta);
+    if (new_count > 0)
+        memcpy(Ranges.Data + range_lo, new_ranges, (size_t)new_count * sizeof(ImGuiSelectionRange));
+}
+
+// Iterator stores the next index to visit + 1 (so that NULL means beginning), _IterRange caches the range it belongs to.
+bool ImGuiSelectionRangeStorage::GetNextSelectedItem(void** opaque_it, ImGuiID* out_id)
+{
+    const intptr_t it = (intptr_t)*opaque_it;
+    int idx = (it == 0) ? 0 : (int)(it - 1);
+    int range_n = (it == 0) ? 0 : _IterRange;
+    if (range_n < 0 || range_n >= Ranges.Size || idx < Ranges.Data[range_n].First)
+        range_n = ImGuiSelectionRangeStorage_LowerBound(Ranges.Data, Ranges.Size, idx);
+    while (range_n < Ranges.Size && Ranges.Data[range_n].Last < idx)
+        range_n++;
+    if (range_n >= Ranges.Size)
+    {
+        *out_id = 0;
+        return false;
+    }
+    idx = ImMax(idx, Ranges.Data[range_n].First);
+    _IterRange = range_n;
+    *opaque_it = (void*)((intptr_t)idx + 2);
+    *out_id = (ImGuiID)idx;
+    return true;
+}
+
+// Apply requests coming from BeginMultiSelect() and EndMultiSelect().
+// Each request is applied as a single range operation, regardless of the number of items it covers.
+void ImGuiSelectionRangeStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
+{
+    IM_ASSERT(ms_io->ItemsCount != -1 && "Missing value for items_count in BeginMultiSelect() call!");
+    for (ImGuiSelectionRequest& req : ms_io->Requests)
+    {
+        if (req.Type == ImGuiSelectionRequestType_SetAll)
+        {
+            Clear();
+            if (req.Selected && ms_io->ItemsCount > 0)
+                SetRangeSelected(0, ms_io->ItemsCount - 1, true);
+        }
+        else if (req.Type == ImGuiSelectionRequestType_SetRange)
+        {
+            SetRangeSelected((int)req.RangeFirstItem, (int)req.RangeLastItem, req.Selected);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
 ImGuiSelectionExternalStorage::ImGuiSelectionExternalStorage()
 {
     UserData = NULL;
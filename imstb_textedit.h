@@ -181,6 +181,8 @@
 //    STB_TEXTEDIT_K_LINEEND2            secondary keyboard input to move cursor to end of line
 //    STB_TEXTEDIT_K_TEXTSTART2          secondary keyboard input to move cursor to start of text
 //    STB_TEXTEDIT_K_TEXTEND2            secondary keyboard input to move cursor to end of text
+//    IMSTB_TEXTEDIT_FINDROWFROMCHAR(obj,n,prev_start*,y*)   [DEAR IMGUI] returns start of a row at or before the one containing char n, so row search may skip preceding rows
+//    IMSTB_TEXTEDIT_FINDROWFROMY(obj,y,row_y*)              [DEAR IMGUI] returns start of a row at or before the one straddling y, so row search may skip preceding rows
 //
 // To support UTF-8:
 //
@@ -442,6 +444,10 @@ static int stb_text_locate_coord(IMSTB_TEXTEDIT_STRING *str, float x, float y, i
    r.num_chars = 0;
    *out_side_on_line = 0;
 
+#ifdef IMSTB_TEXTEDIT_FINDROWFROMY
+   i = IMSTB_TEXTEDIT_FINDROWFROMY(str, y, &base_y); // [DEAR IMGUI] skip rows using line index
+#endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -580,6 +586,9 @@ static void stb_textedit_find_charpos(StbFindState *find, IMSTB_TEXTEDIT_STRING
 
    // search rows to find the one that straddles character n
    find->y = 0;
+#ifdef IMSTB_TEXTEDIT_FINDROWFROMCHAR
+   i = IMSTB_TEXTEDIT_FINDROWFROMCHAR(str, n, &prev_start, &find->y); // [DEAR IMGUI] skip rows using line index
+#endif
 
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);